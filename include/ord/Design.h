@@ -152,8 +152,8 @@ class Design
 
   void readDb(std::istream& stream);
   void readDb(const std::string& file_name);
-  void writeDb(std::ostream& stream);
-  void writeDb(const std::string& file_name);
+  void writeDb(std::ostream& stream, bool compress = false);
+  void writeDb(const std::string& file_name, bool compress = false);
   void writeDef(const std::string& file_name);
 
   odb::dbBlock* getBlock();
@@ -236,8 +236,8 @@ class OpenRoad
 
   void readDb(std::istream& stream);
   void readDb(const char* filename);
-  void writeDb(std::ostream& stream);
-  void writeDb(const char* filename);
+  void writeDb(std::ostream& stream, bool compress = false);
+  void writeDb(const char* filename, bool compress = false);
 
   void diffDbs(const char* filename1, const char* filename2, const char* diffs);
 
@@ -113,16 +113,16 @@ void Design::readDb(const std::string& file_name)
   app->readDb(file_name.c_str());
 }
 
-void Design::writeDb(std::ostream& stream)
+void Design::writeDb(std::ostream& stream, const bool compress)
 {
   auto app = OpenRoad::openRoad();
-  app->writeDb(stream);
+  app->writeDb(stream, compress);
 }
 
-void Design::writeDb(const std::string& file_name)
+void Design::writeDb(const std::string& file_name, const bool compress)
 {
   auto app = OpenRoad::openRoad();
-  app->writeDb(file_name.c_str());
+  app->writeDb(file_name.c_str(), compress);
 }
 
 void Design::writeDef(const std::string& file_name)
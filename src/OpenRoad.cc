@@ -465,17 +465,17 @@ void OpenRoad::readDb(std::istream& stream)
   }
 }
 
-void OpenRoad::writeDb(std::ostream& stream)
+void OpenRoad::writeDb(std::ostream& stream, const bool compress)
 {
   stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  db_->write(stream);
+  db_->write(stream, compress);
 }
 
-void OpenRoad::writeDb(const char* filename)
+void OpenRoad::writeDb(const char* filename, const bool compress)
 {
   utl::StreamHandler stream_handler(filename, true);
 
-  db_->write(stream_handler.getStream());
+  db_->write(stream_handler.getStream(), compress);
 }
 
 void OpenRoad::diffDbs(const char* filename1,
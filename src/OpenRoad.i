@@ -404,10 +404,11 @@ read_db_cmd(const char *filename)
 }
 
 void
-write_db_cmd(const char *filename)
+write_db_cmd(const char *filename,
+             bool compress)
 {
   OpenRoad *ord = getOpenRoad();
-  ord->writeDb(filename);
+  ord->writeDb(filename, compress);
 }
 
 void
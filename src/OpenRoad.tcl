@@ -197,12 +197,13 @@ proc read_db { args } {
   ord::read_db_cmd $filename
 }
 
-sta::define_cmd_args "write_db" {filename}
+sta::define_cmd_args "write_db" {[-compress] filename}
 
 proc write_db { args } {
+  sta::parse_key_args "write_db" args keys {} flags {-compress}
   sta::check_argc_eq1 "write_db" $args
   set filename [file nativename [lindex $args 0]]
-  ord::write_db_cmd $filename
+  ord::write_db_cmd $filename [info exists flags(-compress)]
 }
 
 sta::define_cmd_args "assign_ndr" { -ndr name (-net name | -all_clocks) }
@@ -32,6 +32,7 @@
 #pragma once
 
 #include <map>
+#include <mutex>
 #include <queue>
 #include <set>
 
@@ -108,6 +109,15 @@ struct ViolationReport
   ViolationReport() { violated = false; }
 };
 
+// Outcome of checking one net, kept until the next check of all nets.
+// Only the report of a violating net is kept.
+struct NetCheckResult
+{
+  size_t signature = 0;
+  int pin_violation_count = 0;
+  ViolationReport report;
+};
+
 class GlobalRouteSource
 {
  public:
@@ -133,6 +143,16 @@ using Violations = std::vector<Violation>;
 using GateToViolationLayers
     = std::map<odb::dbITerm*, std::set<odb::dbTechLayer*>>;
 
+// Violations of one net found by getAntennaViolations for the given diode
+// and margin.
+struct NetViolationsResult
+{
+  size_t signature = 0;
+  odb::dbMTerm* diode_mterm = nullptr;
+  float ratio_margin = 0;
+  Violations violations;
+};
+
 class AntennaChecker
 {
  public:
@@ -171,9 +191,9 @@ class AntennaChecker
   void checkNet(odb::dbNet* net,
                 bool verbose,
                 bool report_if_no_violation,
-                std::ofstream& report_file,
                 odb::dbMTerm* diode_mterm,
                 float ratio_margin,
+                ViolationReport& net_report,
                 int& net_violation_count,
                 int& pin_violation_count,
                 Violations& antenna_violations);
@@ -184,42 +204,45 @@ class AntennaChecker
                       GateToLayerToNodeInfo& gate_info);
   void calculatePAR(GateToLayerToNodeInfo& gate_info);
   void calculateCAR(GateToLayerToNodeInfo& gate_info);
-  bool checkRatioViolations(odb::dbNet* db_net,
+  bool checkRatioViolations(ViolationReport& net_report,
                             odb::dbTechLayer* layer,
                             const NodeInfo& node_info,
                             float ratio_margin,
                             bool verbose,
                             bool report);
-  void writeReport(std::ofstream& report_file, bool verbose);
-  void printReport();
+  void writeReport(std::ofstream& report_file,
+                   const std::vector<NetCheckResult>& results,
+                   bool verbose);
+  void printReport(const std::vector<NetCheckResult>& results);
+  size_t netSignature(odb::dbNet* net);
   int checkGates(odb::dbNet* db_net,
                  bool verbose,
                  bool report_if_no_violation,
-                 std::ofstream& report_file,
                  odb::dbMTerm* diode_mterm,
                  float ratio_margin,
                  GateToLayerToNodeInfo& gate_info,
+                 ViolationReport& net_report,
                  Violations& antenna_violations);
   void calculateViaPar(odb::dbTechLayer* tech_layer, NodeInfo& info);
   void calculateWirePar(odb::dbTechLayer* tech_layer, NodeInfo& info);
-  bool checkPAR(odb::dbNet* db_net,
+  bool checkPAR(ViolationReport& net_report,
                 odb::dbTechLayer* tech_layer,
                 const NodeInfo& info,
                 float ratio_margin,
                 bool verbose,
                 bool report);
-  bool checkPSR(odb::dbNet* db_net,
+  bool checkPSR(ViolationReport& net_report,
                 odb::dbTechLayer* tech_layer,
                 const NodeInfo& info,
                 float ratio_margin,
                 bool verbose,
                 bool report);
-  bool checkCAR(odb::dbNet* db_net,
+  bool checkCAR(ViolationReport& net_report,
                 odb::dbTechLayer* tech_layer,
                 const NodeInfo& info,
                 bool verbose,
                 bool report);
-  bool checkCSR(odb::dbNet* db_net,
+  bool checkCSR(ViolationReport& net_report,
                 odb::dbTechLayer* tech_layer,
                 const NodeInfo& info,
                 bool verbose,
@@ -233,7 +256,9 @@ class AntennaChecker
   int net_violation_count_{0};
   std::string report_file_name_;
   std::vector<odb::dbNet*> nets_;
-  std::map<odb::dbNet*, ViolationReport> net_to_report_;
+  std::map<odb::dbNet*, NetCheckResult> net_check_cache_;
+  std::map<odb::dbNet*, NetViolationsResult> net_violations_cache_;
+  std::mutex net_violations_cache_mutex_;
   // consts
   static constexpr int max_diode_count_per_gate = 10;
 };
@@ -34,6 +34,7 @@
 #include <omp.h>
 #include <tcl.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/pending/disjoint_sets.hpp>
 #include <cstdio>
 #include <cstring>
@@ -96,17 +97,13 @@ void AntennaChecker::init(odb::dbDatabase* db,
 
 void AntennaChecker::initAntennaRules()
 {
-  block_ = db_->getChip()->getBlock();
-  odb::dbTech* tech = db_->getTech();
-  // initialize nets_to_report_ with all nets to avoid issues with
-  // multithreading
-  if (net_to_report_.empty()) {
-    for (odb::dbNet* net : block_->getNets()) {
-      if (!net->isSpecial()) {
-        net_to_report_[net];
-      }
-    }
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  if (block != block_) {
+    net_check_cache_.clear();
+    net_violations_cache_.clear();
   }
+  block_ = block;
+  odb::dbTech* tech = db_->getTech();
 
   if (!layer_info_.empty()) {
     return;
@@ -339,14 +336,14 @@ void AntennaChecker::calculateWirePar(odb::dbTechLayer* tech_layer,
                                       NodeInfo& info)
 {
   // get info from layer map
-  const double diff_metal_factor = layer_info_[tech_layer].diff_metal_factor;
+  const double diff_metal_factor = layer_info_.at(tech_layer).diff_metal_factor;
   const double diff_side_metal_factor
-      = layer_info_[tech_layer].diff_side_metal_factor;
-  const double minus_diff_factor = layer_info_[tech_layer].minus_diff_factor;
-  const double plus_diff_factor = layer_info_[tech_layer].plus_diff_factor;
+      = layer_info_.at(tech_layer).diff_side_metal_factor;
+  const double minus_diff_factor = layer_info_.at(tech_layer).minus_diff_factor;
+  const double plus_diff_factor = layer_info_.at(tech_layer).plus_diff_factor;
 
-  const double metal_factor = layer_info_[tech_layer].metal_factor;
-  const double side_metal_factor = layer_info_[tech_layer].side_metal_factor;
+  const double metal_factor = layer_info_.at(tech_layer).metal_factor;
+  const double side_metal_factor = layer_info_.at(tech_layer).side_metal_factor;
 
   double diff_metal_reduce_factor = 1.0;
   if (tech_layer->hasDefaultAntennaRule()) {
@@ -388,10 +385,10 @@ void AntennaChecker::calculateViaPar(odb::dbTechLayer* tech_layer,
                                      NodeInfo& info)
 {
   // get info from layer map
-  const double diff_cut_factor = layer_info_[tech_layer].diff_cut_factor;
-  const double minus_diff_factor = layer_info_[tech_layer].minus_diff_factor;
-  const double plus_diff_factor = layer_info_[tech_layer].plus_diff_factor;
-  const double cut_factor = layer_info_[tech_layer].cut_factor;
+  const double diff_cut_factor = layer_info_.at(tech_layer).diff_cut_factor;
+  const double minus_diff_factor = layer_info_.at(tech_layer).minus_diff_factor;
+  const double plus_diff_factor = layer_info_.at(tech_layer).plus_diff_factor;
+  const double cut_factor = layer_info_.at(tech_layer).cut_factor;
 
   double diff_metal_reduce_factor = 1.0;
   if (tech_layer->hasDefaultAntennaRule()) {
@@ -522,7 +519,7 @@ void AntennaChecker::calculateCAR(GateToLayerToNodeInfo& gate_info)
   }
 }
 
-bool AntennaChecker::checkPAR(odb::dbNet* db_net,
+bool AntennaChecker::checkPAR(ViolationReport& net_report,
                               odb::dbTechLayer* tech_layer,
                               const NodeInfo& info,
                               const float ratio_margin,
@@ -552,7 +549,7 @@ bool AntennaChecker::checkPAR(odb::dbNet* db_net,
           info.PAR,
           PAR_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += par_report + "\n";
+      net_report.report += par_report + "\n";
     }
   } else {
     if (diff_PAR_PWL_ratio != 0) {
@@ -566,13 +563,13 @@ bool AntennaChecker::checkPAR(odb::dbNet* db_net,
           info.diff_PAR,
           diff_PAR_PWL_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += diff_par_report + "\n";
+      net_report.report += diff_par_report + "\n";
     }
   }
   return violation;
 }
 
-bool AntennaChecker::checkPSR(odb::dbNet* db_net,
+bool AntennaChecker::checkPSR(ViolationReport& net_report,
                               odb::dbTechLayer* tech_layer,
                               const NodeInfo& info,
                               const float ratio_margin,
@@ -603,7 +600,7 @@ bool AntennaChecker::checkPSR(odb::dbNet* db_net,
           info.PSR,
           PSR_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += psr_report + "\n";
+      net_report.report += psr_report + "\n";
     }
   } else {
     if (diff_PSR_PWL_ratio != 0) {
@@ -617,13 +614,13 @@ bool AntennaChecker::checkPSR(odb::dbNet* db_net,
           info.diff_PSR,
           diff_PSR_PWL_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += diff_psr_report + "\n";
+      net_report.report += diff_psr_report + "\n";
     }
   }
   return violation;
 }
 
-bool AntennaChecker::checkCAR(odb::dbNet* db_net,
+bool AntennaChecker::checkCAR(ViolationReport& net_report,
                               odb::dbTechLayer* tech_layer,
                               const NodeInfo& info,
                               bool verbose,
@@ -650,7 +647,7 @@ bool AntennaChecker::checkCAR(odb::dbNet* db_net,
           info.CAR,
           CAR_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += car_report + "\n";
+      net_report.report += car_report + "\n";
     }
   } else {
     if (diff_CAR_PWL_ratio != 0) {
@@ -664,13 +661,13 @@ bool AntennaChecker::checkCAR(odb::dbNet* db_net,
           info.diff_CAR,
           diff_CAR_PWL_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += diff_car_report + "\n";
+      net_report.report += diff_car_report + "\n";
     }
   }
   return violation;
 }
 
-bool AntennaChecker::checkCSR(odb::dbNet* db_net,
+bool AntennaChecker::checkCSR(ViolationReport& net_report,
                               odb::dbTechLayer* tech_layer,
                               const NodeInfo& info,
                               bool verbose,
@@ -697,7 +694,7 @@ bool AntennaChecker::checkCSR(odb::dbNet* db_net,
           info.CSR,
           CSR_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += csr_report + "\n";
+      net_report.report += csr_report + "\n";
     }
   } else {
     if (diff_CSR_PWL_ratio != 0) {
@@ -711,13 +708,13 @@ bool AntennaChecker::checkCSR(odb::dbNet* db_net,
           info.diff_CSR,
           diff_CSR_PWL_ratio,
           violation ? "(VIOLATED)" : "");
-      net_to_report_.at(db_net).report += diff_csr_report + "\n";
+      net_report.report += diff_csr_report + "\n";
     }
   }
   return violation;
 }
 
-bool AntennaChecker::checkRatioViolations(odb::dbNet* db_net,
+bool AntennaChecker::checkRatioViolations(ViolationReport& net_report,
                                           odb::dbTechLayer* layer,
                                           const NodeInfo& node_info,
                                           const float ratio_margin,
@@ -725,32 +722,35 @@ bool AntennaChecker::checkRatioViolations(odb::dbNet* db_net,
                                           bool report)
 {
   bool node_has_violation
-      = checkPAR(db_net, layer, node_info, ratio_margin, verbose, report)
-        || checkCAR(db_net, layer, node_info, verbose, report);
+      = checkPAR(net_report, layer, node_info, ratio_margin, verbose, report)
+        || checkCAR(net_report, layer, node_info, verbose, report);
   if (layer->getRoutingLevel() != 0) {
-    bool psr_violation
-        = checkPSR(db_net, layer, node_info, ratio_margin, verbose, report);
-    bool csr_violation = checkCSR(db_net, layer, node_info, verbose, report);
+    bool psr_violation = checkPSR(
+        net_report, layer, node_info, ratio_margin, verbose, report);
+    bool csr_violation
+        = checkCSR(net_report, layer, node_info, verbose, report);
     node_has_violation = node_has_violation || psr_violation || csr_violation;
   }
 
   return node_has_violation;
 }
 
-void AntennaChecker::writeReport(std::ofstream& report_file, bool verbose)
+void AntennaChecker::writeReport(std::ofstream& report_file,
+                                 const std::vector<NetCheckResult>& results,
+                                 bool verbose)
 {
-  for (const auto& [net, violation_report] : net_to_report_) {
-    if (verbose || violation_report.violated) {
-      report_file << violation_report.report;
+  for (const NetCheckResult& result : results) {
+    if (verbose || result.report.violated) {
+      report_file << result.report.report;
     }
   }
 }
 
-void AntennaChecker::printReport()
+void AntennaChecker::printReport(const std::vector<NetCheckResult>& results)
 {
-  for (const auto& [net, violation_report] : net_to_report_) {
-    if (violation_report.violated) {
-      logger_->report("{}", violation_report.report);
+  for (const NetCheckResult& result : results) {
+    if (result.report.violated) {
+      logger_->report("{}", result.report.report);
     }
   }
 }
@@ -758,10 +758,10 @@ void AntennaChecker::printReport()
 int AntennaChecker::checkGates(odb::dbNet* db_net,
                                bool verbose,
                                bool report_if_no_violation,
-                               std::ofstream& report_file,
                                odb::dbMTerm* diode_mterm,
                                float ratio_margin,
                                GateToLayerToNodeInfo& gate_info,
+                               ViolationReport& net_report,
                                Violations& antenna_violations)
 {
   int pin_violation_count = 0;
@@ -769,7 +769,7 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
   GateToViolationLayers gates_with_violations;
 
   std::string net_name = fmt::format("Net: {}", db_net->getConstName());
-  net_to_report_.at(db_net).report += net_name + "\n";
+  net_report.report += net_name + "\n";
 
   for (const auto& [node, layer_to_node] : gate_info) {
     bool pin_has_violation = false;
@@ -779,29 +779,29 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
                                        node->getInst()->getConstName(),
                                        mterm->getConstName(),
                                        mterm->getMaster()->getConstName());
-    net_to_report_.at(db_net).report += pin_name + "\n";
+    net_report.report += pin_name + "\n";
 
     for (const auto& [layer, node_info] : layer_to_node) {
       if (layer->hasDefaultAntennaRule()) {
         std::string layer_name
             = fmt::format("    Layer: {}", layer->getConstName());
-        net_to_report_.at(db_net).report += layer_name + "\n";
+        net_report.report += layer_name + "\n";
 
         bool node_has_violation = checkRatioViolations(
-            db_net, layer, node_info, ratio_margin, verbose, true);
+            net_report, layer, node_info, ratio_margin, verbose, true);
 
-        net_to_report_.at(db_net).report += "\n";
+        net_report.report += "\n";
         if (node_has_violation) {
           pin_has_violation = true;
           gates_with_violations[node].insert(layer);
-          net_to_report_.at(db_net).violated = true;
+          net_report.violated = true;
         }
       }
     }
     if (pin_has_violation) {
       pin_violation_count++;
     }
-    net_to_report_.at(db_net).report += "\n";
+    net_report.report += "\n";
   }
 
   std::map<odb::dbTechLayer*, std::set<odb::dbITerm*>> pin_added;
@@ -820,13 +820,13 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
           odb::dbTechLayer* violation_layer = layer;
           int diode_count_per_gate = 0;
           // check violations only PAR & PSR
-          bool par_violation = checkPAR(db_net,
+          bool par_violation = checkPAR(net_report,
                                         violation_layer,
                                         violation_info,
                                         ratio_margin,
                                         false,
                                         false);
-          bool psr_violation = checkPSR(db_net,
+          bool psr_violation = checkPSR(net_report,
                                         violation_layer,
                                         violation_info,
                                         ratio_margin,
@@ -842,13 +842,13 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
               // re-calculate info only PAR & PSR
               calculateWirePar(violation_layer, violation_info);
               // re-check violations only PAR & PSR
-              par_violation = checkPAR(db_net,
+              par_violation = checkPAR(net_report,
                                        violation_layer,
                                        violation_info,
                                        ratio_margin,
                                        false,
                                        false);
-              psr_violation = checkPSR(db_net,
+              psr_violation = checkPSR(net_report,
                                        violation_layer,
                                        violation_info,
                                        ratio_margin,
@@ -877,10 +877,10 @@ int AntennaChecker::checkGates(odb::dbNet* db_net,
                                           diode_count_per_gate});
           }
 
-          bool car_violation
-              = checkCAR(db_net, violation_layer, violation_info, false, false);
-          bool csr_violation
-              = checkCSR(db_net, violation_layer, violation_info, false, false);
+          bool car_violation = checkCAR(
+              net_report, violation_layer, violation_info, false, false);
+          bool csr_violation = checkCSR(
+              net_report, violation_layer, violation_info, false, false);
 
           // naive approach for cumulative area violations. here, all the pins
           // of the net are included, and placing one diode per pin is not the
@@ -978,9 +978,9 @@ void AntennaChecker::buildLayerMaps(odb::dbNet* db_net,
 void AntennaChecker::checkNet(odb::dbNet* db_net,
                               bool verbose,
                               bool report_if_no_violation,
-                              std::ofstream& report_file,
                               odb::dbMTerm* diode_mterm,
                               float ratio_margin,
+                              ViolationReport& net_report,
                               int& net_violation_count,
                               int& pin_violation_count,
                               Violations& antenna_violations)
@@ -999,10 +999,10 @@ void AntennaChecker::checkNet(odb::dbNet* db_net,
     int pin_violations = checkGates(db_net,
                                     verbose,
                                     report_if_no_violation,
-                                    report_file,
                                     diode_mterm,
                                     ratio_margin,
                                     gate_info,
+                                    net_report,
                                     antenna_violations);
 
     if (pin_violations > 0) {
@@ -1021,24 +1021,52 @@ Violations AntennaChecker::getAntennaViolations(odb::dbNet* net,
     return antenna_violations;
   }
 
-  // for the case where the check_net_violation api is called directly
-  if (net_to_report_.find(net) == net_to_report_.end()) {
-    net_to_report_[net];
+  // Repair calls this for every net on each pass, usually with the same
+  // diode and margin, so nets that did not change reuse their violations.
+  const size_t signature = netSignature(net);
+  {
+    std::lock_guard<std::mutex> lock(net_violations_cache_mutex_);
+    auto cached = net_violations_cache_.find(net);
+    if (cached != net_violations_cache_.end()
+        && cached->second.signature == signature
+        && cached->second.diode_mterm == diode_mterm
+        && cached->second.ratio_margin == ratio_margin) {
+      debugPrint(logger_,
+                 ANT,
+                 "check_cache",
+                 1,
+                 "Reused violations of net {}.",
+                 net->getConstName());
+      return cached->second.violations;
+    }
   }
 
   int net_violation_count, pin_violation_count;
   net_violation_count = 0;
   pin_violation_count = 0;
-  std::ofstream report_file;
+  ViolationReport net_report;
   checkNet(net,
            false,
            false,
-           report_file,
            diode_mterm,
            ratio_margin,
+           net_report,
            net_violation_count,
            pin_violation_count,
            antenna_violations);
+  debugPrint(logger_,
+             ANT,
+             "check_cache",
+             1,
+             "Checked violations of net {}.",
+             net->getConstName());
+
+  std::lock_guard<std::mutex> lock(net_violations_cache_mutex_);
+  NetViolationsResult& result = net_violations_cache_[net];
+  result.signature = signature;
+  result.diode_mterm = diode_mterm;
+  result.ratio_margin = ratio_margin;
+  result.violations = antenna_violations;
 
   return antenna_violations;
 }
@@ -1047,7 +1075,6 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
                                   const int num_threads,
                                   bool verbose)
 {
-  net_to_report_.clear();
   initAntennaRules();
 
   std::ofstream report_file;
@@ -1075,49 +1102,81 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
   int net_violation_count = 0;
   int pin_violation_count = 0;
 
+  nets_.clear();
+  std::vector<NetCheckResult> results;
   if (net) {
-    Violations antenna_violations;
     if (!net->isSpecial()) {
+      nets_.push_back(net);
+      results.resize(1);
+      Violations antenna_violations;
       checkNet(net,
                verbose,
                true,
-               report_file,
                nullptr,
                0,
+               results[0].report,
                net_violation_count,
-               pin_violation_count,
+               results[0].pin_violation_count,
                antenna_violations);
     } else {
       logger_->error(
           ANT, 14, "Skipped net {} because it is special.", net->getName());
     }
   } else {
-    nets_.clear();
     for (odb::dbNet* net : block_->getNets()) {
       if (!net->isSpecial()) {
         nets_.push_back(net);
       }
     }
+    // Each net is checked into its own result so the reports come out in
+    // net order whatever the thread count.  Without -verbose, nets whose
+    // wire and gates are unchanged since the previous check reuse its
+    // result.  A verbose report also lists the nets without violations,
+    // which are not kept, so it checks every net.
+    results.resize(nets_.size());
+    int reused_count = 0;
     omp_set_num_threads(num_threads);
-#pragma omp parallel for schedule(dynamic) \
-    reduction(+ : net_violation_count, pin_violation_count)
+#pragma omp parallel for schedule(dynamic) reduction(+ : reused_count)
     for (int i = 0; i < nets_.size(); i++) {
       odb::dbNet* net = nets_[i];
+      NetCheckResult& result = results[i];
+      result.signature = netSignature(net);
+      auto cached = net_check_cache_.find(net);
+      if (!verbose && cached != net_check_cache_.end()
+          && cached->second.signature == result.signature) {
+        result = cached->second;
+        reused_count++;
+        continue;
+      }
+      int net_violations = 0;
       Violations antenna_violations;
       checkNet(net,
                verbose,
                false,
-               report_file,
                nullptr,
                0,
-               net_violation_count,
-               pin_violation_count,
+               result.report,
+               net_violations,
+               result.pin_violation_count,
                antenna_violations);
     }
+    for (const NetCheckResult& result : results) {
+      if (result.pin_violation_count > 0) {
+        net_violation_count++;
+        pin_violation_count += result.pin_violation_count;
+      }
+    }
+    debugPrint(logger_,
+               ANT,
+               "check_cache",
+               1,
+               "Checked {} nets, reused {} cached results.",
+               nets_.size() - reused_count,
+               reused_count);
   }
 
   if (verbose) {
-    printReport();
+    printReport(results);
   }
 
   logger_->info(ANT, 2, "Found {} net violations.", net_violation_count);
@@ -1126,10 +1185,23 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
   logger_->metric("antenna__violating__pins", pin_violation_count);
 
   if (!report_file_name_.empty()) {
-    writeReport(report_file, verbose);
+    writeReport(report_file, results, verbose);
     report_file.close();
   }
-  net_to_report_.clear();
+
+  // The cache holds one entry per net of the last non verbose check of all
+  // nets and the report text only of the violating ones.
+  if (!net && !verbose) {
+    net_check_cache_.clear();
+    for (int i = 0; i < nets_.size(); i++) {
+      NetCheckResult& result = results[i];
+      if (!result.report.violated) {
+        result.report.report.clear();
+        result.report.report.shrink_to_fit();
+      }
+      net_check_cache_[nets_[i]] = std::move(result);
+    }
+  }
 
   if (use_grt_routes) {
     global_route_source_->destroyNetWires();
@@ -1139,6 +1211,27 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
   return net_violation_count;
 }
 
+// Hash of everything the check of a net depends on besides the antenna
+// rules: its name, wire and connected gates.
+size_t AntennaChecker::netSignature(odb::dbNet* net)
+{
+  size_t signature = 0;
+  boost::hash_combine(signature, net->getName());
+  odb::dbWire* wire = net->getWire();
+  if (wire) {
+    const int length = wire->length();
+    for (int i = 0; i < length; i++) {
+      boost::hash_combine(signature, wire->getData(i));
+      boost::hash_combine(signature, wire->getOpcode(i));
+    }
+  }
+  for (odb::dbITerm* iterm : net->getITerms()) {
+    boost::hash_combine(signature, iterm->getId());
+    boost::hash_combine(signature, iterm->getMTerm());
+  }
+  return signature;
+}
+
 int AntennaChecker::antennaViolationCount() const
 {
   return net_violation_count_;
@@ -0,0 +1,18 @@
+source "helpers.tcl"
+# check_antennas only re-checks nets that changed since the last check
+read_lef merged_spacing.lef
+read_def sw130_random.def
+
+set_debug_level ANT check_cache 1
+
+check_antennas
+check_antennas
+puts "Net net50 violations: [ant::check_net_violation net50]"
+puts "Net net50 violations: [ant::check_net_violation net50]"
+
+# edit the wire of net50 only
+set net [[ord::get_db_block] findNet net50]
+odb::dbWire_destroy [$net getWire]
+
+check_antennas
+puts "Net net50 violations: [ant::check_net_violation net50]"
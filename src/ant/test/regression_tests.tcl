@@ -4,6 +4,7 @@ record_tests {
   check_grt1
   ant_check
   ant_report
+  check_cache1
   #ant_readme_msgs_check
   #ant_man_tcl_check
 }
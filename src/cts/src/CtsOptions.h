@@ -252,6 +252,14 @@ class CtsOptions
   void setCtsLibrary(const char* name) { ctsLibrary_ = name; }
   const char* getCtsLibrary() { return ctsLibrary_.c_str(); }
   bool isCtsLibrarySet() { return !ctsLibrary_.empty(); }
+  void setCharacterizationCache(const std::string& file)
+  {
+    characterizationCache_ = file;
+  }
+  const std::string& getCharacterizationCache() const
+  {
+    return characterizationCache_;
+  }
 
  private:
   std::string clockNets_ = "";
@@ -311,6 +319,7 @@ class CtsOptions
   bool dummyLoad_ = true;
   float delayBufferDerate_ = 1.0;  // no derate
   std::string ctsLibrary_;
+  std::string characterizationCache_;
 };
 
 }  // namespace cts
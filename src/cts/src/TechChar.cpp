@@ -36,6 +36,8 @@
 #include "TechChar.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <ostream>
@@ -43,6 +45,7 @@
 
 #include "db_sta/dbSta.hh"
 #include "rsz/Resizer.hh"
+#include "sta/Corner.hh"
 #include "sta/Graph.hh"
 #include "sta/Liberty.hh"
 #include "sta/PathAnalysisPt.hh"
@@ -1541,10 +1544,213 @@ unsigned TechChar::normalizeCharResults(float value,
   return normVal;
 }
 
+// FNV-1a over the bytes of the value, so the key is the same in every run
+// and build.
+static void hashFloat(uint64_t& hash, const float value)
+{
+  unsigned char bytes[sizeof(float)];
+  std::memcpy(bytes, &value, sizeof(float));
+  for (const unsigned char byte : bytes) {
+    hash ^= byte;
+    hash *= 1099511628211ULL;
+  }
+}
+
+static void hashTable(uint64_t& hash, const sta::TableModel* table)
+{
+  if (table == nullptr) {
+    return;
+  }
+  const sta::TableAxis* axes[3]
+      = {table->axis1(), table->axis2(), table->axis3()};
+  size_t sizes[3] = {1, 1, 1};
+  for (int i = 0; i < 3; i++) {
+    if (axes[i]) {
+      const sta::FloatSeq* values = axes[i]->values();
+      sizes[i] = values->size();
+      for (const float value : *values) {
+        hashFloat(hash, value);
+      }
+    }
+  }
+  for (size_t i = 0; i < sizes[0]; i++) {
+    for (size_t j = 0; j < sizes[1]; j++) {
+      for (size_t k = 0; k < sizes[2]; k++) {
+        hashFloat(hash, table->value(i, j, k));
+      }
+    }
+  }
+}
+
+// Hash of the buffer data the characterization uses: the pin capacitances
+// and the delay and slew tables of the buffer arcs.
+static uint64_t bufferHash(sta::LibertyCell* libertyCell)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  sta::LibertyPort *input, *output;
+  libertyCell->bufferPorts(input, output);
+  if (input == nullptr || output == nullptr) {
+    return hash;
+  }
+  hashFloat(hash, input->capacitance());
+  hashFloat(hash, output->capacitance());
+  for (sta::TimingArcSet* arcSet : libertyCell->timingArcSets(input, output)) {
+    for (const sta::TimingArc* arc : arcSet->arcs()) {
+      const sta::GateTableModel* gateModel
+          = dynamic_cast<sta::GateTableModel*>(arc->model());
+      if (gateModel) {
+        hashTable(hash, gateModel->delayModel());
+        hashTable(hash, gateModel->slewModel());
+      }
+    }
+  }
+  return hash;
+}
+
+// Describes everything the characterization results depend on: the
+// buffers' timing and capacitance data, the analysis corner, the clock
+// layer RC and the wirelength/load/slew axes.  The buffer data is hashed
+// rather than keyed on the liberty file name, so an edited library with
+// the same name does not reuse stale results.
+std::string TechChar::characterizationKey() const
+{
+  std::ostringstream key;
+  key << "buffer " << charBuf_->getName();
+  key << " corner " << openSta_->cmdCorner()->name();
+  for (const std::string& master : masterNames_) {
+    key << " master " << master;
+    sta::Cell* masterCell
+        = db_network_->dbToSta(db_->findMaster(master.c_str()));
+    sta::LibertyCell* libertyCell = db_network_->libertyCell(masterCell);
+    if (libertyCell) {
+      key << " " << std::hex << bufferHash(libertyCell) << std::dec;
+    }
+  }
+  key << std::setprecision(9) << " res " << resPerDBU_ << " cap "
+      << capPerDBU_ << " unit " << options_->getWireSegmentUnit()
+      << " max_slew " << options_->getMaxCharSlew() << " slew_step "
+      << charSlewStepSize_ << " cap_step " << charCapStepSize_;
+  key << " wirelengths";
+  for (float wirelength : wirelengthsToTest_) {
+    key << " " << wirelength;
+  }
+  key << " loads";
+  for (float load : loadsToTest_) {
+    key << " " << load;
+  }
+  key << " slews";
+  for (float slew : slewsToTest_) {
+    key << " " << slew;
+  }
+  return key.str();
+}
+
+static const char* const charCacheHeader = "cts characterization 1";
+
+bool TechChar::readCharacterization(const std::string& fileName,
+                                    const std::string& key,
+                                    std::vector<ResultData>& solutions)
+{
+  std::ifstream file(fileName);
+  if (!file) {
+    return false;
+  }
+  std::string header, fileKey;
+  std::getline(file, header);
+  std::getline(file, fileKey);
+  if (header != charCacheHeader || fileKey != key) {
+    logger_->info(CTS, 127, "Characterization in {} is out of date.", fileName);
+    return false;
+  }
+
+  unsigned bounds[6];
+  size_t count = 0;
+  for (unsigned& bound : bounds) {
+    file >> bound;
+  }
+  file >> count;
+  solutions.clear();
+  for (size_t i = 0; i < count && file; i++) {
+    ResultData result;
+    size_t topologySize = 0;
+    file >> result.load >> result.inSlew >> result.wirelength
+        >> result.pinSlew >> result.pinArrival >> result.totalcap
+        >> result.totalPower >> result.isPureWire >> topologySize;
+    result.topology.resize(topologySize);
+    for (std::string& topology : result.topology) {
+      file >> topology;
+    }
+    solutions.push_back(std::move(result));
+  }
+  if (!file) {
+    logger_->warn(CTS, 128, "Unable to read characterization {}.", fileName);
+    solutions.clear();
+    return false;
+  }
+
+  minSegmentLength_ = bounds[0];
+  maxSegmentLength_ = bounds[1];
+  minCapacitance_ = bounds[2];
+  maxCapacitance_ = bounds[3];
+  minSlew_ = bounds[4];
+  maxSlew_ = bounds[5];
+  return true;
+}
+
+void TechChar::writeCharacterization(
+    const std::string& fileName,
+    const std::string& key,
+    const std::vector<ResultData>& solutions) const
+{
+  std::ofstream file(fileName);
+  if (!file) {
+    logger_->warn(CTS, 129, "Unable to write characterization {}.", fileName);
+    return;
+  }
+  file << charCacheHeader << "\n" << key << "\n";
+  file << minSegmentLength_ << " " << maxSegmentLength_ << " "
+       << minCapacitance_ << " " << maxCapacitance_ << " " << minSlew_ << " "
+       << maxSlew_ << "\n";
+  file << solutions.size() << "\n";
+  file << std::setprecision(9);
+  for (const ResultData& result : solutions) {
+    file << result.load << " " << result.inSlew << " " << result.wirelength
+         << " " << result.pinSlew << " " << result.pinArrival << " "
+         << result.totalcap << " " << result.totalPower << " "
+         << result.isPureWire << " " << result.topology.size();
+    for (const std::string& topology : result.topology) {
+      file << " " << topology;
+    }
+    file << "\n";
+  }
+}
+
 void TechChar::create()
 {
+  // Results of a previous call would otherwise be mixed into this one.
+  masterNames_.clear();
+  wirelengthsToTest_.clear();
+  loadsToTest_.clear();
+  slewsToTest_.clear();
+  solutionMap_.clear();
+  wireSegments_.clear();
+  keyToWireSegments_.clear();
+
   // Setup of the attributes required to run the characterization.
   initCharacterization();
+
+  const std::string& cacheFile = options_->getCharacterizationCache();
+  const std::string charKey = characterizationKey();
+  if (!cacheFile.empty()) {
+    std::vector<ResultData> cachedSolutions;
+    if (readCharacterization(cacheFile, charKey, cachedSolutions)) {
+      logger_->info(CTS, 126, "Read characterization from {}.", cacheFile);
+      compileLut(cachedSolutions);
+      odb::dbBlock::destroy(charBlock_);
+      return;
+    }
+  }
+
   long unsigned int topologiesCreated = 0;
   for (unsigned setupWirelength : wirelengthsToTest_) {
     // Creates the topologies for the current wirelength.
@@ -1681,6 +1887,10 @@ void TechChar::create()
   // Post-processing of the results.
   const std::vector<ResultData> convertedSolutions
       = characterizationPostProcess();
+  if (!cacheFile.empty()) {
+    writeCharacterization(cacheFile, charKey, convertedSolutions);
+    logger_->info(CTS, 130, "Wrote characterization to {}.", cacheFile);
+  }
   compileLut(convertedSolutions);
   if (logger_->debugCheck(CTS, "characterization", 3)) {
     printCharacterization();
@@ -302,6 +302,13 @@ class TechChar
                           unsigned nodeIndex,
                           const std::string& newMasterName);
   std::vector<ResultData> characterizationPostProcess();
+  std::string characterizationKey() const;
+  bool readCharacterization(const std::string& fileName,
+                            const std::string& key,
+                            std::vector<ResultData>& solutions);
+  void writeCharacterization(const std::string& fileName,
+                             const std::string& key,
+                             const std::vector<ResultData>& solutions) const;
   unsigned normalizeCharResults(float value,
                                 float iter,
                                 unsigned* min,
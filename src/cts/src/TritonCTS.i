@@ -260,6 +260,12 @@ set_cts_library(const char* name)
   getTritonCts()->getParms()->setCtsLibrary(name);
 }
 
+void
+set_characterization_cache(const char* file)
+{
+  getTritonCts()->getParms()->setCharacterizationCache(file);
+}
+
 void
 run_triton_cts()
 {
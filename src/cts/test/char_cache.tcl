@@ -0,0 +1,35 @@
+# -characterization_cache writes, reuses and refreshes the characterization
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def "no_sinks.def"
+
+create_clock -period 5 clk
+set_wire_rc -clock -layer metal5
+
+# The file path is relative so it does not show up absolute in the log.
+make_result_file char_cache.txt
+set cache_file results/char_cache-tcl.txt
+file delete -force $cache_file
+
+# miss: no file yet
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+  -buf_list CLKBUF_X3 \
+  -wire_unit 20 \
+  -clk_nets "clk" \
+  -characterization_cache $cache_file
+
+# hit: same buffers, corner and wire RC
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+  -buf_list CLKBUF_X3 \
+  -wire_unit 20 \
+  -clk_nets "clk" \
+  -characterization_cache $cache_file
+
+# miss: the clock wire RC changed
+set_wire_rc -clock -layer metal3
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+  -buf_list CLKBUF_X3 \
+  -wire_unit 20 \
+  -clk_nets "clk" \
+  -characterization_cache $cache_file
@@ -17,6 +17,7 @@ record_tests {
   max_cap
   no_clocks
   no_sinks
+  char_cache
   post_cts_opt
   simple_test
   simple_test_clustered
@@ -139,6 +139,8 @@ class Opendp
                          const std::string& report_file_name = std::string(""),
                          bool disallow_one_site_gaps = false);
   void reportLegalizationStats() const;
+  // Threads used to legalize independent row bands in detailedPlacement.
+  void setThreadCount(int threads);
 
   void setPaddingGlobal(int left, int right);
   void setPadding(dbMaster* master, int left, int right);
@@ -234,6 +236,7 @@ class Opendp
                    GridY y,
                    GridX x_end,
                    GridY y_end) const;
+  bool placeRowBands(const vector<Cell*>& sorted_cells);
   void shiftMove(Cell* cell);
   bool mapMove(Cell* cell);
   bool mapMove(Cell* cell, const GridPt& grid_pt);
@@ -361,6 +364,7 @@ class Opendp
   int max_displacement_y_ = 0;  // sites
   bool disallow_one_site_gaps_ = false;
   vector<Cell*> placement_failures_;
+  int num_threads_ = 1;
 
   // 3D pixel grid
   std::unique_ptr<Grid> grid_;
@@ -39,6 +39,7 @@
 
 #include "dpl/Opendp.h"
 
+#include <algorithm>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <cfloat>
@@ -108,6 +109,11 @@ void Opendp::setPadding(dbMaster* master, const int left, const int right)
   padding_->setPadding(master, GridX{left}, GridX{right});
 }
 
+void Opendp::setThreadCount(const int threads)
+{
+  num_threads_ = std::max(threads, 1);
+}
+
 void Opendp::setDebug(std::unique_ptr<DplObserver>& observer)
 {
   debug_observer_ = std::move(observer);
@@ -35,13 +35,16 @@
 sta::define_cmd_args "detailed_placement" { \
                            [-max_displacement disp|{disp_x disp_y}] \
                            [-disallow_one_site_gaps] \
+                           [-serial] \
                            [-report_file_name file_name]}
 
 proc detailed_placement { args } {
   sta::parse_key_args "detailed_placement" args \
-    keys {-max_displacement -report_file_name} flags {-disallow_one_site_gaps}
+    keys {-max_displacement -report_file_name} \
+    flags {-disallow_one_site_gaps -serial}
 
   set disallow_one_site_gaps [info exists flags(-disallow_one_site_gaps)]
+  set serial [info exists flags(-serial)]
   if { [info exists keys(-max_displacement)] } {
     set max_displacement $keys(-max_displacement)
     if { [llength $max_displacement] == 1 } {
@@ -74,7 +77,7 @@ proc detailed_placement { args } {
     set max_displacement_y [expr [ord::microns_to_dbu $max_displacement_y] \
       / [$site getHeight]]
     dpl::detailed_placement_cmd $max_displacement_x $max_displacement_y \
-      $disallow_one_site_gaps $file_name
+      $disallow_one_site_gaps $serial $file_name
     dpl::report_legalization_stats
   } else {
     utl::error "DPL" 27 "no rows defined in design. Use initialize_floorplan to add rows."
@@ -49,6 +49,7 @@
 #include "Padding.h"
 #include "dpl/Opendp.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 // #define ODP_DEBUG
 
@@ -343,6 +344,9 @@ void Opendp::place()
       }
     }
   }
+  if (num_threads_ > 1 && placeRowBands(sorted_cells)) {
+    return;
+  }
   for (Cell* cell : sorted_cells) {
     if (!isMultiRow(cell)) {
       if (!mapMove(cell)) {
@@ -352,6 +356,84 @@ void Opendp::place()
   }
 }
 
+// Legalize the single row cells in horizontal bands of rows.  A band is at
+// least twice as tall as the rows a diamond search can touch around its
+// starting row, so the searches in every other band never share pixels.
+// The even bands are placed concurrently, then the odd bands, each band in
+// sorted cell order.  The bands only depend on the grid so the result is the
+// same for any thread count.  Cells that don't fit in their band are placed
+// serially at the end.  Returns false without placing anything when the
+// grid cannot be split.
+bool Opendp::placeRowBands(const vector<Cell*>& sorted_cells)
+{
+  // Painting hybrid or multi height grids touches the other grid layers.
+  if (debug_observer_ || grid_->hasHybridRows()
+      || grid_->getInfoMap().size() != 1) {
+    return false;
+  }
+
+  vector<Cell*> cells;
+  vector<GridPt> grid_pts;
+  int max_height = 1;
+  for (Cell* cell : sorted_cells) {
+    if (!isMultiRow(cell)) {
+      cells.push_back(cell);
+      // Only depends on fixed cells so it is safe to find up front.
+      grid_pts.push_back(legalGridPt(cell, true));
+      max_height = max(max_height, grid_->gridHeight(cell).v);
+    }
+  }
+
+  // The search reads one row beyond the cell for one site gaps.
+  const int reach = max_displacement_y_ + max_height + 1;
+  const int band_rows = 2 * reach;
+  const GridY row_count = grid_->getInfoMap().begin()->second.getRowCount();
+  const int band_count = row_count.v / band_rows;
+  // Need at least two bands placed concurrently.
+  if (band_count < 4) {
+    return false;
+  }
+
+  vector<vector<int>> bands(band_count);
+  for (int i = 0; i < cells.size(); i++) {
+    const int band = min(grid_pts[i].y.v / band_rows, band_count - 1);
+    bands[band].push_back(i);
+  }
+
+  debugPrint(logger_,
+             DPL,
+             "place",
+             1,
+             "Placing {} cells in {} bands of {} rows",
+             cells.size(),
+             band_count,
+             band_rows);
+
+  for (int parity = 0; parity < 2; parity++) {
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int band = parity; band < band_count; band += 2) {
+      try {
+        for (const int i : bands[band]) {
+          mapMove(cells[i], grid_pts[i]);
+        }
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+  }
+
+  for (Cell* cell : cells) {
+    if (!cell->is_placed_) {
+      if (!mapMove(cell)) {
+        shiftMove(cell);
+      }
+    }
+  }
+  return true;
+}
+
 void Opendp::placeGroups2()
 {
   for (Group& group : groups_) {
@@ -0,0 +1,12 @@
+# aes with -serial on several threads matches the single threaded placement
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def aes_cipher_top_replace.def
+
+set_thread_count 2
+detailed_placement -serial
+check_placement
+
+set def_file [make_result_file aes_serial.def]
+write_def $def_file
+diff_file aes.defok $def_file
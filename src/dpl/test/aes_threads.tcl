@@ -0,0 +1,13 @@
+# aes legalized in concurrent row bands
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def aes_cipher_top_replace.def
+
+set_thread_count 2
+# A small vertical displacement splits the rows into enough bands to be
+# placed concurrently.
+set site [dpl::get_row_site]
+set max_displacement_x [expr [ord::microns_to_dbu 50] / [$site getWidth]]
+set max_displacement_y [expr [ord::microns_to_dbu 10] / [$site getHeight]]
+dpl::detailed_placement_cmd $max_displacement_x $max_displacement_y 0 0 ""
+check_placement
@@ -32,10 +32,12 @@
 
 #include <boost/asio/thread_pool.hpp>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -184,6 +186,14 @@ class TritonRoute
                  const std::list<std::unique_ptr<frMarker>>& markers,
                  odb::Rect drcBox = odb::Rect(0, 0, 0, 0));
   void checkDRC(const char* filename, int x1, int y1, int x2, int y2);
+  // Drops the cached check_drc markers of every tile whose halo overlaps box.
+  void invalidateDRC(const odb::Rect& box);
+  bool hasDRCCache() const { return !drc_tile_markers_.empty(); }
+  // Drops every cached check_drc tile (for testing).
+  void clearDRCCache();
+  // Records a db instance or net whose copy initDesign must re-read.
+  void markInstDirty(odb::dbInst* inst);
+  void markNetDirty(odb::dbNet* net);
   bool initGuide();
   void prep();
   void processBTermsAboveTopLayer(bool has_routing = false);
@@ -210,6 +220,16 @@ class TritonRoute
   int results_sz_{0};
   unsigned int cloud_sz_{0};
   boost::asio::thread_pool dist_pool_{1};
+  // check_drc markers of each (drc box, ext box) tile, reused by later
+  // check_drc calls until DesignCallBack reports an overlapping db change.
+  std::map<std::pair<odb::Rect, odb::Rect>,
+           std::vector<std::unique_ptr<frMarker>>>
+      drc_tile_markers_;
+  std::vector<odb::Rect> drc_dirty_boxes_;
+  // Instances and nets changed in the db since the frDesign was last read
+  // from or written to it.
+  std::set<std::string> dirty_insts_;
+  std::set<std::string> dirty_nets_;
 
   void initDesign();
   void gr();
@@ -217,7 +237,10 @@ class TritonRoute
   void dr();
   void applyUpdates(const std::vector<std::vector<drUpdate>>& updates);
   void getDRCMarkers(std::list<std::unique_ptr<frMarker>>& markers,
-                     const odb::Rect& requiredDrcBox);
+                     const odb::Rect& requiredDrcBox,
+                     bool incremental = false);
+  void updateDRCTiles();
+  void updateDb(bool pin_access = false);
   void stackVias(odb::dbBTerm* bterm,
                  int top_layer_idx,
                  int bterm_bottom_layer_idx,
@@ -39,8 +39,84 @@ static inline int defdist(odb::dbBlock* block, int x)
          / (double) block->getDbUnitsPerMicron();
 }
 
+void DesignCallBack::invalidateDRC(odb::dbBlock* block, const odb::Rect& box)
+{
+  router_->invalidateDRC(odb::Rect(defdist(block, box.xMin()),
+                                   defdist(block, box.yMin()),
+                                   defdist(block, box.xMax()),
+                                   defdist(block, box.yMax())));
+}
+
+void DesignCallBack::invalidateDRC(odb::dbInst* db_inst)
+{
+  if (!router_->hasDRCCache()) {
+    return;
+  }
+  invalidateDRC(db_inst->getBlock(), db_inst->getBBox()->getBox());
+}
+
+void DesignCallBack::invalidateDRC(odb::dbWire* wire)
+{
+  if (!router_->hasDRCCache()) {
+    return;
+  }
+  if (auto box = wire->getBBox()) {
+    invalidateDRC(wire->getBlock(), *box);
+  }
+  // The router's copy of the net still holds the routing the cached markers
+  // were computed from.
+  auto db_net = wire->getNet();
+  auto design = router_->getDesign();
+  if (db_net == nullptr || design == nullptr
+      || design->getTopBlock() == nullptr) {
+    return;
+  }
+  auto net = design->getTopBlock()->findNet(db_net->getName());
+  if (net == nullptr) {
+    return;
+  }
+  odb::Rect box;
+  box.mergeInit();
+  for (auto& shape : net->getShapes()) {
+    box.merge(shape->getBBox());
+  }
+  for (auto& via : net->getVias()) {
+    box.merge(via->getBBox());
+  }
+  for (auto& pwire : net->getPatchWires()) {
+    box.merge(pwire->getBBox());
+  }
+  if (box.xMin() <= box.xMax()) {
+    router_->invalidateDRC(box);
+  }
+}
+
+void DesignCallBack::wireChanged(odb::dbWire* wire)
+{
+  invalidateDRC(wire);
+  router_->markNetDirty(wire->getNet());
+}
+
+void DesignCallBack::inDbInstCreate(odb::dbInst* db_inst)
+{
+  invalidateDRC(db_inst);
+  router_->markInstDirty(db_inst);
+}
+
+void DesignCallBack::inDbInstCreate(odb::dbInst* db_inst, odb::dbRegion*)
+{
+  invalidateDRC(db_inst);
+  router_->markInstDirty(db_inst);
+}
+
+void DesignCallBack::inDbPreMoveInst(odb::dbInst* db_inst)
+{
+  invalidateDRC(db_inst);
+}
+
 void DesignCallBack::inDbPostMoveInst(odb::dbInst* db_inst)
 {
+  invalidateDRC(db_inst);
   auto design = router_->getDesign();
   if (design != nullptr && design->getTopBlock() != nullptr) {
     auto inst = design->getTopBlock()->getInst(db_inst->getName());
@@ -65,6 +141,7 @@ void DesignCallBack::inDbPostMoveInst(odb::dbInst* db_inst)
 
 void DesignCallBack::inDbInstDestroy(odb::dbInst* db_inst)
 {
+  invalidateDRC(db_inst);
   auto design = router_->getDesign();
   if (design != nullptr && design->getTopBlock() != nullptr) {
     auto inst = design->getTopBlock()->getInst(db_inst->getName());
@@ -78,4 +155,91 @@ void DesignCallBack::inDbInstDestroy(odb::dbInst* db_inst)
   }
 }
 
+void DesignCallBack::inDbInstSwapMasterBefore(odb::dbInst* db_inst,
+                                              odb::dbMaster*)
+{
+  invalidateDRC(db_inst);
+}
+
+void DesignCallBack::inDbInstSwapMasterAfter(odb::dbInst* db_inst)
+{
+  invalidateDRC(db_inst);
+  // The router's instance and the pins its nets point at are re-created.
+  router_->markInstDirty(db_inst);
+  for (auto iterm : db_inst->getITerms()) {
+    router_->markNetDirty(iterm->getNet());
+  }
+}
+
+void DesignCallBack::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  invalidateDRC(iterm->getInst());
+  router_->markNetDirty(iterm->getNet());
+}
+
+void DesignCallBack::inDbITermPreDisconnect(odb::dbITerm* iterm)
+{
+  invalidateDRC(iterm->getInst());
+  router_->markNetDirty(iterm->getNet());
+}
+
+void DesignCallBack::inDbBTermPostConnect(odb::dbBTerm* bterm)
+{
+  invalidateDRC(bterm->getBlock(), bterm->getBBox());
+  router_->markNetDirty(bterm->getNet());
+}
+
+void DesignCallBack::inDbBTermPreDisconnect(odb::dbBTerm* bterm)
+{
+  invalidateDRC(bterm->getBlock(), bterm->getBBox());
+  router_->markNetDirty(bterm->getNet());
+}
+
+void DesignCallBack::inDbWireCreate(odb::dbWire* wire)
+{
+  wireChanged(wire);
+}
+
+void DesignCallBack::inDbWireDestroy(odb::dbWire* wire)
+{
+  wireChanged(wire);
+}
+
+void DesignCallBack::inDbWirePostModify(odb::dbWire* wire)
+{
+  wireChanged(wire);
+}
+
+void DesignCallBack::inDbWirePostAttach(odb::dbWire* wire)
+{
+  wireChanged(wire);
+}
+
+void DesignCallBack::inDbWirePreDetach(odb::dbWire* wire)
+{
+  wireChanged(wire);
+}
+
+void DesignCallBack::inDbWirePostAppend(odb::dbWire*, odb::dbWire* dst)
+{
+  wireChanged(dst);
+}
+
+void DesignCallBack::inDbSWireAddSBox(odb::dbSBox* box)
+{
+  invalidateDRC(box->getSWire()->getBlock(), box->getBox());
+}
+
+void DesignCallBack::inDbSWireRemoveSBox(odb::dbSBox* box)
+{
+  invalidateDRC(box->getSWire()->getBlock(), box->getBox());
+}
+
+void DesignCallBack::inDbSWirePreDestroySBoxes(odb::dbSWire* wire)
+{
+  for (auto box : wire->getWires()) {
+    invalidateDRC(wire->getBlock(), box->getBox());
+  }
+}
+
 }  // namespace drt
@@ -36,10 +36,37 @@ class DesignCallBack : public odb::dbBlockCallBackObj
 {
  public:
   DesignCallBack(TritonRoute* router) : router_(router) {}
+  void inDbInstCreate(odb::dbInst* inst) override;
+  void inDbInstCreate(odb::dbInst* inst, odb::dbRegion* region) override;
+  void inDbPreMoveInst(odb::dbInst* inst) override;
   void inDbPostMoveInst(odb::dbInst* inst) override;
   void inDbInstDestroy(odb::dbInst* inst) override;
+  void inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                odb::dbMaster* master) override;
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbITermPreDisconnect(odb::dbITerm* iterm) override;
+  void inDbBTermPostConnect(odb::dbBTerm* bterm) override;
+  void inDbBTermPreDisconnect(odb::dbBTerm* bterm) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePreDetach(odb::dbWire* wire) override;
+  void inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbSWireAddSBox(odb::dbSBox* box) override;
+  void inDbSWireRemoveSBox(odb::dbSBox* box) override;
+  void inDbSWirePreDestroySBoxes(odb::dbSWire* wire) override;
 
  private:
+  // Invalidates the check_drc tiles covering an object that is about to
+  // change or has just changed.
+  void invalidateDRC(odb::dbBlock* block, const odb::Rect& box);
+  void invalidateDRC(odb::dbInst* inst);
+  void invalidateDRC(odb::dbWire* wire);
+  // Marks the net of a changed wire for re-reading by updateDesign.
+  void wireChanged(odb::dbWire* wire);
+
   TritonRoute* router_;
 };
 }  // namespace drt
@@ -44,6 +44,7 @@
 #include "dst/Distributed.h"
 #include "frDesign.h"
 #include "frProfileTask.h"
+#include "frRTree.h"
 #include "gc/FlexGC.h"
 #include "global.h"
 #include "gr/FlexGR.h"
@@ -310,6 +311,7 @@ void TritonRoute::updateGlobals(const char* file_name)
 void TritonRoute::resetDb(const char* file_name)
 {
   design_ = std::make_unique<frDesign>(logger_);
+  clearDRCCache();
   ord::OpenRoad::openRoad()->readDb(file_name);
   initDesign();
   if (!db_->getChip()->getBlock()->getAccessPoints().empty()) {
@@ -322,6 +324,7 @@ void TritonRoute::resetDb(const char* file_name)
 void TritonRoute::clearDesign()
 {
   design_ = std::make_unique<frDesign>(logger_);
+  clearDRCCache();
 }
 
 static void deserializeUpdate(frDesign* design,
@@ -558,7 +561,9 @@ void TritonRoute::initDesign()
   }
   io::Parser parser(db_, getDesign(), logger_);
   if (getDesign()->getTopBlock() != nullptr) {
-    parser.updateDesign();
+    parser.updateDesign(dirty_insts_, dirty_nets_);
+    dirty_insts_.clear();
+    dirty_nets_.clear();
     return;
   }
   parser.readTechAndLibs(db_);
@@ -601,6 +606,8 @@ void TritonRoute::initDesign()
   }
   parser.postProcess();
   db_callback_->addOwner(db_->getChip()->getBlock());
+  dirty_insts_.clear();
+  dirty_nets_.clear();
 }
 
 void TritonRoute::prep()
@@ -665,9 +672,9 @@ void TritonRoute::endFR()
     dr_->end(/* done */ true);
   }
   dr_.reset();
-  io::Writer writer(this, logger_);
-  writer.updateDb(db_);
+  updateDb();
   if (debug_->writeNetTracks) {
+    io::Writer writer(this, logger_);
     writer.updateTrackAssignment(db_->getChip()->getBlock());
   }
 
@@ -973,8 +980,7 @@ int TritonRoute::main()
     pa_pool.join();
     pa.main();
     if (distributed_ || debug_->debugDR || debug_->debugDumpDR) {
-      io::Writer writer(this, logger_);
-      writer.updateDb(db_, true);
+      updateDb(/* pin_access */ true);
     }
     if (distributed_) {
       asio::post(dist_pool_, [this]() {
@@ -1035,8 +1041,7 @@ void TritonRoute::pinAccess(const std::vector<odb::dbInst*>& target_insts)
     dist_pool_.join();
   }
   pa.main();
-  io::Writer writer(this, logger_);
-  writer.updateDb(db_, true);
+  updateDb(/* pin_access */ true);
 }
 
 void TritonRoute::fixMaxSpacing()
@@ -1047,15 +1052,90 @@ void TritonRoute::fixMaxSpacing()
   dr_ = std::make_unique<FlexDR>(this, getDesign(), logger_, db_);
   dr_->init();
   dr_->fixMaxSpacing();
+  updateDb();
+}
+
+void TritonRoute::invalidateDRC(const Rect& box)
+{
+  if (!drc_tile_markers_.empty()) {
+    drc_dirty_boxes_.push_back(box);
+  }
+}
+
+void TritonRoute::clearDRCCache()
+{
+  drc_tile_markers_.clear();
+  drc_dirty_boxes_.clear();
+}
+
+void TritonRoute::markInstDirty(odb::dbInst* inst)
+{
+  dirty_insts_.insert(inst->getName());
+}
+
+void TritonRoute::markNetDirty(odb::dbNet* net)
+{
+  if (net != nullptr) {
+    dirty_nets_.insert(net->getName());
+  }
+}
+
+void TritonRoute::updateDb(bool pin_access)
+{
   io::Writer writer(this, logger_);
-  writer.updateDb(db_);
+  writer.updateDb(db_, pin_access);
+  // The db now matches the frDesign, so the edits reported while writing
+  // need not be read back.
+  dirty_insts_.clear();
+  dirty_nets_.clear();
+}
+
+void TritonRoute::updateDRCTiles()
+{
+  if (drc_dirty_boxes_.empty()) {
+    return;
+  }
+  std::vector<std::pair<Rect, int>> boxes;
+  boxes.reserve(drc_dirty_boxes_.size());
+  for (const Rect& box : drc_dirty_boxes_) {
+    boxes.emplace_back(box, 0);
+  }
+  RTree<int> dirty(boxes);
+  for (auto it = drc_tile_markers_.begin(); it != drc_tile_markers_.end();) {
+    const Rect& extBox = it->first.second;
+    if (dirty.qbegin(bgi::intersects(extBox)) != dirty.qend()) {
+      it = drc_tile_markers_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  debugPrint(logger_,
+             utl::DRT,
+             "check_drc",
+             1,
+             "{} db changes, {} tiles still cached.",
+             drc_dirty_boxes_.size(),
+             drc_tile_markers_.size());
+  drc_dirty_boxes_.clear();
 }
 
 void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
-                                const Rect& requiredDrcBox)
+                                const Rect& requiredDrcBox,
+                                bool incremental)
 {
   MAX_THREADS = ord::OpenRoad::openRoad()->getThreadCount();
+  // Tiles are keyed by their (drc box, ext box) pair; the markers of a tile
+  // depend only on the shapes inside its ext box, so incremental calls reuse
+  // every tile that updateDRCTiles has not invalidated.
+  std::map<std::pair<Rect, Rect>, std::vector<std::unique_ptr<frMarker>>>
+      local_tile_markers;
+  if (incremental) {
+    updateDRCTiles();
+  }
+  auto& tile_markers = incremental ? drc_tile_markers_ : local_tile_markers;
+  std::vector<std::pair<Rect, Rect>> tiles;
   std::vector<std::vector<std::unique_ptr<FlexGCWorker>>> workersBatches(1);
+  std::vector<std::vector<std::pair<Rect, Rect>>> tilesBatches(1);
   auto size = 7;
   auto offset = 0;
   auto gCellPatterns = design_->getTopBlock()->getGCellPatterns();
@@ -1078,43 +1158,56 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
       if (!drcBox.intersects(requiredDrcBox)) {
         continue;
       }
+      tiles.emplace_back(drcBox, extBox);
+      if (tile_markers.find(tiles.back()) != tile_markers.end()) {
+        continue;
+      }
       auto gcWorker
           = std::make_unique<FlexGCWorker>(design_->getTech(), logger_);
       gcWorker->setDrcBox(drcBox);
       gcWorker->setExtBox(extBox);
       if (workersBatches.back().size() >= BATCHSIZE) {
         workersBatches.emplace_back();
+        tilesBatches.emplace_back();
       }
       workersBatches.back().push_back(std::move(gcWorker));
+      tilesBatches.back().push_back(tiles.back());
     }
   }
-  std::map<MarkerId, frMarker*> mapMarkers;
   omp_set_num_threads(MAX_THREADS);
-  for (auto& workers : workersBatches) {
+  for (int b = 0; b < workersBatches.size(); b++) {  // NOLINT
+    auto& workers = workersBatches[b];
 #pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < workers.size(); i++) {  // NOLINT
       workers[i]->init(design_.get());
       workers[i]->main();
     }
-    for (const auto& worker : workers) {
-      for (auto& marker : worker->getMarkers()) {
-        Rect bbox = marker->getBBox();
-        if (!bbox.intersects(requiredDrcBox)) {
-          continue;
-        }
-        auto layerNum = marker->getLayerNum();
-        auto con = marker->getConstraint();
-        if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
-            != mapMarkers.end()) {
-          continue;
-        }
-        markers.push_back(std::make_unique<frMarker>(*marker));
-        mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
-            = markers.back().get();
+    for (int i = 0; i < workers.size(); i++) {  // NOLINT
+      auto& tile = tile_markers[tilesBatches[b][i]];
+      for (auto& marker : workers[i]->getMarkers()) {
+        tile.push_back(std::make_unique<frMarker>(*marker));
       }
     }
     workers.clear();
   }
+  std::map<MarkerId, frMarker*> mapMarkers;
+  for (const auto& tile : tiles) {
+    for (auto& marker : tile_markers[tile]) {
+      Rect bbox = marker->getBBox();
+      if (!bbox.intersects(requiredDrcBox)) {
+        continue;
+      }
+      auto layerNum = marker->getLayerNum();
+      auto con = marker->getConstraint();
+      if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
+          != mapMarkers.end()) {
+        continue;
+      }
+      markers.push_back(std::make_unique<frMarker>(*marker));
+      mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
+          = markers.back().get();
+    }
+  }
 }
 
 void TritonRoute::checkDRC(const char* filename, int x1, int y1, int x2, int y2)
@@ -1136,7 +1229,7 @@ void TritonRoute::checkDRC(const char* filename, int x1, int y1, int x2, int y2)
     requiredDrcBox = design_->getTopBlock()->getBBox();
   }
   frList<std::unique_ptr<frMarker>> markers;
-  getDRCMarkers(markers, requiredDrcBox);
+  getDRCMarkers(markers, requiredDrcBox, /* incremental */ true);
   reportDRC(filename, markers, requiredDrcBox);
 }
 
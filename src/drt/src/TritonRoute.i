@@ -243,4 +243,16 @@ void check_drc_cmd(const char* drc_file, int x1, int y1, int x2, int y2)
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   router->checkDRC(drc_file, x1, y1, x2, y2);
 }
+
+void clear_drc_cache_cmd()
+{
+  auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
+  router->clearDRCCache();
+}
+
+void clear_design_cmd()
+{
+  auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
+  router->clearDesign();
+}
 %} // inline
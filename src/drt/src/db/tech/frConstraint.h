@@ -1052,7 +1052,7 @@ class frSpacingRangeConstraint : public frSpacingConstraint
  public:
   // getters
   frCoord getMinWidth() const { return minWidth; }
-  frCoord getMaxWidth() const { return minWidth; }
+  frCoord getMaxWidth() const { return maxWidth; }
   // setters
   void setMinWidth(frCoord in) { minWidth = in; }
   void setMaxWidth(frCoord in) { maxWidth = in; }
@@ -31,11 +31,12 @@
 #include <dst/JobMessage.h>
 #include <omp.h>
 
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
 #include <chrono>
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <numeric>
@@ -257,12 +258,26 @@ int FlexDRWorker::main(frDesign* design)
       workerFile.close();
     }
     {
-      std::ofstream globalsFile(
-          fmt::format("{}/worker_globals.bin", workerPath).c_str());
-      frOArchive ar(globalsFile);
-      registerTypes(ar);
-      serializeGlobals(ar);
-      globalsFile.close();
+      // Every worker dumped in an iteration sees the same globals, which
+      // searchRepair writes once; link that file instead of re-serializing.
+      const std::string iterGlobals = fmt::format(
+          "{}/globals.{}.bin", debugSettings_->dumpDir, getDRIter());
+      const std::string workerGlobals
+          = fmt::format("{}/worker_globals.bin", workerPath);
+      std::error_code ec;
+      std::filesystem::remove(workerGlobals, ec);
+      bool linked = false;
+      if (std::filesystem::exists(iterGlobals, ec)) {
+        std::filesystem::create_hard_link(iterGlobals, workerGlobals, ec);
+        linked = !ec;
+      }
+      if (!linked) {
+        std::ofstream globalsFile(workerGlobals.c_str());
+        frOArchive ar(globalsFile);
+        registerTypes(ar);
+        serializeGlobals(ar);
+        globalsFile.close();
+      }
     }
   }
   if (!skipRouting_) {
@@ -274,6 +289,20 @@ int FlexDRWorker::main(frDesign* design)
   }
   high_resolution_clock::time_point t2 = high_resolution_clock::now();
   const int num_markers = getNumMarkers();
+  if (gridGraph_.getNumNodes() > 0) {
+    const size_t bytes = gridGraph_.getNodeMemoryUsage();
+    debugPrint(logger_,
+               DRT,
+               "memory",
+               1,
+               "worker ({:.3f} {:.3f}) grid graph {} nodes {} bytes ({:.2f} "
+               "bytes/node)",
+               routeBox_.xMin() * micronPerDBU,
+               routeBox_.yMin() * micronPerDBU,
+               gridGraph_.getNumNodes(),
+               bytes,
+               bytes / (double) gridGraph_.getNumNodes());
+  }
   cleanup();
   high_resolution_clock::time_point t3 = high_resolution_clock::now();
 
@@ -585,6 +614,12 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
       router_->writeGlobals(globals_path_);
     }
   }
+  const frDebugSettings* debugSettings = router_->getDebugSettings();
+  if (debugSettings->debugDumpDR
+      && (debugSettings->iter == iter || debugSettings->dumpLastWorker)) {
+    router_->writeGlobals(
+        fmt::format("{}/globals.{}.bin", debugSettings->dumpDir, iter));
+  }
   frTime t;
   if (VERBOSE > 0) {
     std::string suffix;
@@ -1440,6 +1475,8 @@ int FlexDR::main()
     }
   }
 
+  FlexGridGraph::releaseSpareStorage();
+
   end(/* done */ true);
   if (!GUIDE_REPORT_FILE.empty()) {
     reportGuideCoverage();
@@ -1461,11 +1498,26 @@ void FlexDR::sendWorkers(
   std::vector<std::pair<int, std::string>> workers;
   {
     ProfileTask task("DIST: SERIALIZE_BATCH");
+    const auto start = std::chrono::steady_clock::now();
+    size_t bytes = 0;
     for (auto& [idx, worker] : remote_batch) {
       std::string workerStr;
       serializeWorker(worker, workerStr);
-      workers.emplace_back(idx, workerStr);
+      bytes += workerStr.size();
+      workers.emplace_back(idx, std::move(workerStr));
     }
+    const std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    debugPrint(logger_,
+               DRT,
+               "dist",
+               1,
+               "serialized {} workers into {} bytes ({} bytes/worker) in "
+               "{:.3f}s",
+               workers.size(),
+               bytes,
+               bytes / workers.size(),
+               elapsed.count());
   }
   std::string remote_ip = dist_ip_;
   uint16_t remote_port = dist_port_;
@@ -219,12 +219,8 @@ void FlexDRWorkerRegionQuery::query(const Rect& box,
                                     const frLayerNum layerNum,
                                     std::vector<drConnFig*>& result) const
 {
-  std::vector<rq_box_value_t<drConnFig*>> temp;
-  impl_->shapes_.at(layerNum).query(bgi::intersects(box), back_inserter(temp));
-  result.reserve(temp.size());
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->shapes_.at(layerNum).query(bgi::intersects(box),
+                                    valueInserter(result));
 }
 
 void FlexDRWorkerRegionQuery::query(
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <utility>
 
 #include "dr/FlexDR.h"
 
@@ -52,6 +53,77 @@ bool FlexGridGraph::isAccessPointLocation(frLayerNum layer_num,
   const auto& layer_maze_locs = ap_locs_[layer_num];
   return layer_maze_locs.find(Point(x_coord, y_coord)) != layer_maze_locs.end();
 }
+std::mutex FlexGridGraph::spare_storage_mutex_;
+std::vector<FlexGridGraph::Storage> FlexGridGraph::spare_storage_;
+
+void FlexGridGraph::releaseSpareStorage()
+{
+  std::lock_guard<std::mutex> lock(spare_storage_mutex_);
+  spare_storage_.clear();
+  spare_storage_.shrink_to_fit();
+}
+
+void FlexGridGraph::stashStorage()
+{
+  if (nodes_.capacity() == 0) {
+    return;
+  }
+  Storage storage;
+  storage.nodes.swap(nodes_);
+  storage.markerCosts.swap(markerCosts_);
+  storage.ndrCosts.swap(ndrCosts_);
+  storage.prevDirs.swap(prevDirs_);
+  storage.srcs.swap(srcs_);
+  storage.dsts.swap(dsts_);
+  storage.guides.swap(guides_);
+  std::lock_guard<std::mutex> lock(spare_storage_mutex_);
+  spare_storage_.push_back(std::move(storage));
+}
+
+void FlexGridGraph::reuseStorage()
+{
+  Storage storage;
+  {
+    std::lock_guard<std::mutex> lock(spare_storage_mutex_);
+    if (spare_storage_.empty()) {
+      return;
+    }
+    storage = std::move(spare_storage_.back());
+    spare_storage_.pop_back();
+  }
+  auto reuse = [](auto& in_use, auto& spare) {
+    if (in_use.capacity() < spare.capacity()) {
+      in_use.swap(spare);
+    }
+  };
+  reuse(nodes_, storage.nodes);
+  reuse(markerCosts_, storage.markerCosts);
+  reuse(ndrCosts_, storage.ndrCosts);
+  reuse(prevDirs_, storage.prevDirs);
+  reuse(srcs_, storage.srcs);
+  reuse(dsts_, storage.dsts);
+  reuse(guides_, storage.guides);
+}
+
+void FlexGridGraph::allocMarkerCosts()
+{
+  markerCosts_.assign(nodes_.size(), MarkerCosts());
+}
+
+void FlexGridGraph::allocNDRCosts()
+{
+  ndrCosts_.assign(nodes_.size(), NDRCosts());
+}
+
+size_t FlexGridGraph::getNodeMemoryUsage() const
+{
+  auto bits = [](const std::vector<bool>& v) { return v.capacity() / 8; };
+  return nodes_.capacity() * sizeof(Node)
+         + markerCosts_.capacity() * sizeof(MarkerCosts)
+         + ndrCosts_.capacity() * sizeof(NDRCosts) + bits(prevDirs_)
+         + bits(srcs_) + bits(dsts_) + bits(guides_);
+}
+
 void FlexGridGraph::initGrids(
     const std::map<frCoord, std::map<frLayerNum, frTrackPattern*>>& xMap,
     const std::map<frCoord, std::map<frLayerNum, frTrackPattern*>>& yMap,
@@ -86,7 +158,10 @@ void FlexGridGraph::initGrids(
   getDim(xDim, yDim, zDim);
   const int capacity = xDim * yDim * zDim;
 
+  reuseStorage();
   nodes_.clear();
+  markerCosts_.clear();
+  ndrCosts_.clear();
   nodes_.resize(capacity, Node());
   // new
   prevDirs_.clear();
@@ -32,6 +32,8 @@
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <vector>
 
 #include "FlexMazeTypes.h"
 #include "db/drObj/drPin.h"
@@ -258,32 +260,28 @@ class FlexGridGraph
     frUInt4 sol = 0;
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      const Node& node = nodes_[idx];
       if (dir == frDirEnum::W || dir == frDirEnum::E) {
-        if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostPlanarHorz,
-                         node.fixedShapeCostPlanarHorzNDR);
-        } else {
-          sol = node.fixedShapeCostPlanarHorz;
+        sol = node.fixedShapeCostPlanarHorz;
+        if (consider_ndr && !ndrCosts_.empty()) {
+          sol = std::max(sol, (frUInt4) ndrCosts_[idx].fixedShapeCostPlanarHorz);
         }
       } else {
-        if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostPlanarVert,
-                         node.fixedShapeCostPlanarVertNDR);
-        } else {
-          sol = node.fixedShapeCostPlanarVert;
+        sol = node.fixedShapeCostPlanarVert;
+        if (consider_ndr && !ndrCosts_.empty()) {
+          sol = std::max(sol, (frUInt4) ndrCosts_[idx].fixedShapeCostPlanarVert);
         }
       }
     } else {
       correctU(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
       if (isOverrideShapeCost(x, y, z, dir)) {
         sol = 0;
       } else {
-        if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostVia, node.fixedShapeCostViaNDR);
-        } else {
-          sol = node.fixedShapeCostVia;
+        sol = nodes_[idx].fixedShapeCostVia;
+        if (consider_ndr && !ndrCosts_.empty()) {
+          sol = std::max(sol, (frUInt4) ndrCosts_[idx].fixedShapeCostVia);
         }
       }
     }
@@ -317,20 +315,16 @@ class FlexGridGraph
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostPlanar,
-                       nodes_[idx].routeShapeCostPlanarNDR);
-      } else {
-        sol = nodes_[idx].routeShapeCostPlanar;
+      sol = nodes_[idx].routeShapeCostPlanar;
+      if (consider_ndr && !ndrCosts_.empty()) {
+        sol = std::max(sol, (frUInt4) ndrCosts_[idx].routeShapeCostPlanar);
       }
     } else {
       correctU(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostVia,
-                       nodes_[idx].routeShapeCostViaNDR);
-      } else {
-        sol = nodes_[idx].routeShapeCostVia;
+      sol = nodes_[idx].routeShapeCostVia;
+      if (consider_ndr && !ndrCosts_.empty()) {
+        sol = std::max(sol, (frUInt4) ndrCosts_[idx].routeShapeCostVia);
       }
     }
     return (sol);
@@ -347,15 +341,17 @@ class FlexGridGraph
   frUInt4 getMarkerCostAdj(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir) const
   {
     frUInt4 sol = 0;
-    // old
+    if (markerCosts_.empty()) {
+      return sol;
+    }
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostPlanar;
+      sol += markerCosts_[idx].planar;
     } else {
       correctU(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      sol += nodes_[idx].markerCostVia;
+      sol += markerCosts_[idx].via;
     }
     return (sol);
   }
@@ -512,38 +508,45 @@ class FlexGridGraph
   }
   void addRouteShapeCostPlanar(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
+    const auto idx = getIdx(x, y, z);
     if (ndr) {
-      node.routeShapeCostPlanarNDR = addToByte(node.routeShapeCostPlanarNDR, 1);
+      auto& costs = getNDRCosts(idx);
+      costs.routeShapeCostPlanar = addToByte(costs.routeShapeCostPlanar, 1);
     } else {
+      auto& node = nodes_[idx];
       node.routeShapeCostPlanar = addToByte(node.routeShapeCostPlanar, 1);
     }
   }
   void addRouteShapeCostVia(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
+    const auto idx = getIdx(x, y, z);
     if (ndr) {
-      node.routeShapeCostViaNDR = addToByte(node.routeShapeCostViaNDR, 1);
+      auto& costs = getNDRCosts(idx);
+      costs.routeShapeCostVia = addToByte(costs.routeShapeCostVia, 1);
     } else {
+      auto& node = nodes_[idx];
       node.routeShapeCostVia = addToByte(node.routeShapeCostVia, 1);
     }
   }
   void subRouteShapeCostPlanar(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
+    const auto idx = getIdx(x, y, z);
     if (ndr) {
-      node.routeShapeCostPlanarNDR
-          = subFromByte(node.routeShapeCostPlanarNDR, 1);
+      auto& costs = getNDRCosts(idx);
+      costs.routeShapeCostPlanar = subFromByte(costs.routeShapeCostPlanar, 1);
     } else {
+      auto& node = nodes_[idx];
       node.routeShapeCostPlanar = subFromByte(node.routeShapeCostPlanar, 1);
     }
   }
   void subRouteShapeCostVia(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
+    const auto idx = getIdx(x, y, z);
     if (ndr) {
-      node.routeShapeCostViaNDR = subFromByte(node.routeShapeCostViaNDR, 1);
+      auto& costs = getNDRCosts(idx);
+      costs.routeShapeCostVia = subFromByte(costs.routeShapeCostVia, 1);
     } else {
+      auto& node = nodes_[idx];
       node.routeShapeCostVia = subFromByte(node.routeShapeCostVia, 1);
     }
   }
@@ -551,33 +554,35 @@ class FlexGridGraph
   {
     auto idx = getIdx(x, y, z);
     if (ndr) {
-      nodes_[idx].routeShapeCostViaNDR = 0;
+      if (!ndrCosts_.empty()) {
+        ndrCosts_[idx].routeShapeCostVia = 0;
+      }
     } else {
       nodes_[idx].routeShapeCostVia = 0;
     }
   }
   void addMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
-    node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
+    auto& costs = getMarkerCosts(getIdx(x, y, z));
+    costs.planar = addToByte(costs.planar, 10);
   }
   void addMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto& node = nodes_[getIdx(x, y, z)];
-    node.markerCostVia = addToByte(node.markerCostVia, 10);
+    auto& costs = getMarkerCosts(getIdx(x, y, z));
+    costs.via = addToByte(costs.via, 10);
   }
   void addMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
     correct(x, y, z, dir);
     if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+      auto& costs = getMarkerCosts(getIdx(x, y, z));
       switch (dir) {
         case frDirEnum::E:
         case frDirEnum::N:
-          node.markerCostPlanar = addToByte(node.markerCostPlanar, 10);
+          costs.planar = addToByte(costs.planar, 10);
           break;
         case frDirEnum::U:
-          node.markerCostVia = addToByte(node.markerCostVia, 10);
+          costs.via = addToByte(costs.via, 10);
           break;
         default:;
       }
@@ -585,66 +590,74 @@ class FlexGridGraph
   }
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z, float d)
   {
-    auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostPlanar;
+    if (markerCosts_.empty()) {
+      return true;
+    }
+    auto& costs = markerCosts_[getIdx(x, y, z)];
+    int currCost = costs.planar;
     currCost *= d;
     currCost = std::max(0, currCost);
-    node.markerCostPlanar = currCost;
+    costs.planar = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z, float d)
   {
-    auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostVia;
+    if (markerCosts_.empty()) {
+      return true;
+    }
+    auto& costs = markerCosts_[getIdx(x, y, z)];
+    int currCost = costs.via;
     currCost *= d;
     currCost = std::max(0, currCost);
-    node.markerCostVia = currCost;
+    costs.via = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCostPlanar(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostPlanar;
+    if (markerCosts_.empty()) {
+      return true;
+    }
+    auto& costs = markerCosts_[getIdx(x, y, z)];
+    int currCost = costs.planar;
     currCost--;
     currCost = std::max(0, currCost);
-    node.markerCostPlanar = currCost;
+    costs.planar = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCostVia(frMIdx x, frMIdx y, frMIdx z)
   {
-    auto idx = getIdx(x, y, z);
-    Node& node = nodes_[idx];
-    int currCost = node.markerCostVia;
+    if (markerCosts_.empty()) {
+      return true;
+    }
+    auto& costs = markerCosts_[getIdx(x, y, z)];
+    int currCost = costs.via;
     currCost--;
     currCost = std::max(0, currCost);
-    node.markerCostVia = currCost;
+    costs.via = currCost;
     return (currCost == 0);
   }
   bool decayMarkerCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir, float d)
   {
     correct(x, y, z, dir);
     int currCost = 0;
-    if (isValid(x, y, z)) {
-      Node& node = nodes_[getIdx(x, y, z)];
+    if (isValid(x, y, z) && !markerCosts_.empty()) {
+      auto& costs = markerCosts_[getIdx(x, y, z)];
       switch (dir) {
         case frDirEnum::E:
-          currCost = node.markerCostPlanar;
+          currCost = costs.planar;
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostPlanar = currCost;
+          costs.planar = currCost;
         case frDirEnum::N:
-          currCost = node.markerCostPlanar;
+          currCost = costs.planar;
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostPlanar = currCost;
+          costs.planar = currCost;
         case frDirEnum::U:
-          currCost = node.markerCostVia;
+          currCost = costs.via;
           currCost *= d;
           currCost = std::max(0, currCost);
-          node.markerCostVia = currCost;
+          costs.via = currCost;
         default:;
       }
     }
@@ -653,12 +666,14 @@ class FlexGridGraph
   void addFixedShapeCostPlanar(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      auto& node = nodes_[idx];
       if (ndr) {
-        node.fixedShapeCostPlanarHorzNDR
-            = addToByte(node.fixedShapeCostPlanarHorzNDR, 1);
-        node.fixedShapeCostPlanarVertNDR
-            = addToByte(node.fixedShapeCostPlanarVertNDR, 1);
+        auto& costs = getNDRCosts(idx);
+        costs.fixedShapeCostPlanarHorz
+            = addToByte(costs.fixedShapeCostPlanarHorz, 1);
+        costs.fixedShapeCostPlanarVert
+            = addToByte(costs.fixedShapeCostPlanarVert, 1);
       } else {
         node.fixedShapeCostPlanarHorz
             = addToByte(node.fixedShapeCostPlanarHorz, 1);
@@ -674,11 +689,11 @@ class FlexGridGraph
                                    bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
       if (ndr) {
-        node.fixedShapeCostPlanarVertNDR = c;
+        getNDRCosts(idx).fixedShapeCostPlanarVert = c;
       } else {
-        node.fixedShapeCostPlanarVert = c;
+        nodes_[idx].fixedShapeCostPlanarVert = c;
       }
     }
   }
@@ -689,20 +704,22 @@ class FlexGridGraph
                                    bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
       if (ndr) {
-        node.fixedShapeCostPlanarHorzNDR = c;
+        getNDRCosts(idx).fixedShapeCostPlanarHorz = c;
       } else {
-        node.fixedShapeCostPlanarHorz = c;
+        nodes_[idx].fixedShapeCostPlanarHorz = c;
       }
     }
   }
   void addFixedShapeCostVia(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      auto& node = nodes_[idx];
       if (ndr) {
-        node.fixedShapeCostViaNDR = addToByte(node.fixedShapeCostViaNDR, 1);
+        auto& costs = getNDRCosts(idx);
+        costs.fixedShapeCostVia = addToByte(costs.fixedShapeCostVia, 1);
       } else {
         node.fixedShapeCostVia = addToByte(node.fixedShapeCostVia, 1);
       }
@@ -715,23 +732,25 @@ class FlexGridGraph
                             bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
       if (ndr) {
-        node.fixedShapeCostViaNDR = c;
+        getNDRCosts(idx).fixedShapeCostVia = c;
       } else {
-        node.fixedShapeCostVia = c;
+        nodes_[idx].fixedShapeCostVia = c;
       }
     }
   }
   void subFixedShapeCostPlanar(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      auto& node = nodes_[idx];
       if (ndr) {
-        node.fixedShapeCostPlanarHorzNDR
-            = subFromByte(node.fixedShapeCostPlanarHorzNDR, 1);
-        node.fixedShapeCostPlanarVertNDR
-            = subFromByte(node.fixedShapeCostPlanarVertNDR, 1);
+        auto& costs = getNDRCosts(idx);
+        costs.fixedShapeCostPlanarHorz
+            = subFromByte(costs.fixedShapeCostPlanarHorz, 1);
+        costs.fixedShapeCostPlanarVert
+            = subFromByte(costs.fixedShapeCostPlanarVert, 1);
       } else {
         node.fixedShapeCostPlanarHorz
             = subFromByte(node.fixedShapeCostPlanarHorz, 1);
@@ -743,9 +762,11 @@ class FlexGridGraph
   void subFixedShapeCostVia(frMIdx x, frMIdx y, frMIdx z, bool ndr = false)
   {
     if (isValid(x, y, z)) {
-      auto& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      auto& node = nodes_[idx];
       if (ndr) {
-        node.fixedShapeCostViaNDR = subFromByte(node.fixedShapeCostViaNDR, 1);
+        auto& costs = getNDRCosts(idx);
+        costs.fixedShapeCostVia = subFromByte(costs.fixedShapeCostVia, 1);
       } else {
         node.fixedShapeCostVia = subFromByte(node.fixedShapeCostVia, 1);
       }
@@ -956,14 +977,7 @@ class FlexGridGraph
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
-    nodes_.clear();
-    nodes_.shrink_to_fit();
-    srcs_.clear();
-    srcs_.shrink_to_fit();
-    dsts_.clear();
-    dsts_.shrink_to_fit();
-    guides_.clear();
-    guides_.shrink_to_fit();
+    stashStorage();
     xCoords_.clear();
     xCoords_.shrink_to_fit();
     yCoords_.clear();
@@ -996,8 +1010,11 @@ class FlexGridGraph
     std::cout << "hasGridCostUp " << n.hasGridCostUp << "\n";
     std::cout << "routeShapeCostPlanar " << n.routeShapeCostPlanar << "\n";
     std::cout << "routeShapeCostVia " << n.routeShapeCostVia << "\n";
-    std::cout << "markerCostPlanar " << n.markerCostPlanar << "\n";
-    std::cout << "markerCostVia " << n.markerCostVia << "\n";
+    if (!markerCosts_.empty()) {
+      const MarkerCosts& m = markerCosts_[getIdx(x, y, z)];
+      std::cout << "markerCostPlanar " << m.planar << "\n";
+      std::cout << "markerCostVia " << m.via << "\n";
+    }
     std::cout << "fixedShapeCostVia " << n.fixedShapeCostVia << "\n";
     std::cout << "fixedShapeCostPlanarHorz " << n.fixedShapeCostPlanarHorz
               << "\n";
@@ -1005,6 +1022,12 @@ class FlexGridGraph
               << "\n";
   }
 
+  // Frees the grid storage kept for reuse by later grid graphs.
+  static void releaseSpareStorage();
+  int getNumNodes() const { return nodes_.size(); }
+  // Bytes allocated for the per node data of the grid graph.
+  size_t getNodeMemoryUsage() const;
+
   void addAccessPointLocation(frLayerNum layer_num,
                               frCoord x_coord,
                               frCoord y_coord);
@@ -1051,30 +1074,52 @@ class FlexGridGraph
     // Byte 3
     frUInt4 routeShapeCostVia : cost_bits;
     // Byte4
-    frUInt4 markerCostPlanar : cost_bits;
-    // Byte5
-    frUInt4 markerCostVia : cost_bits;
-    // Byte6
     frUInt4 fixedShapeCostVia : cost_bits;
-    // Byte7
+    // Byte5
     frUInt4 fixedShapeCostPlanarHorz : cost_bits;
-    // Byte8
+    // Byte6
     frUInt4 fixedShapeCostPlanarVert : cost_bits;
-    // Byte9
-    frUInt4 routeShapeCostPlanarNDR : cost_bits;
-    // Byte10
-    frUInt4 routeShapeCostViaNDR : cost_bits;
-    // Byte 11
-    frUInt4 fixedShapeCostViaNDR : cost_bits;
-    // Byte 12
-    frUInt4 fixedShapeCostPlanarHorzNDR : cost_bits;
-    // Byte 13
-    frUInt4 fixedShapeCostPlanarVertNDR : cost_bits;
   };
 #ifndef DEBUG_DRT_UNDERFLOW
-  static_assert(sizeof(Node) == 16);
+  static_assert(sizeof(Node) == 8);
 #endif
+  // Marker and NDR costs are only set on some workers (markers exist after
+  // the first iterations, NDR costs only with NDR nets), so they are kept
+  // out of Node and allocated on first use.  Empty means all zero.
+  struct MarkerCosts
+  {
+    uint16_t planar : cost_bits;
+    uint16_t via : cost_bits;
+  };
+  struct NDRCosts
+  {
+    uint16_t routeShapeCostPlanar : cost_bits;
+    uint16_t routeShapeCostVia : cost_bits;
+    uint16_t fixedShapeCostVia : cost_bits;
+    uint16_t fixedShapeCostPlanarHorz : cost_bits;
+    uint16_t fixedShapeCostPlanarVert : cost_bits;
+  };
+
+  // Grid storage handed back by cleanup() and picked up again by the next
+  // grid graph initialized on any thread.  This avoids reallocating and
+  // faulting in the largest buffers for every worker of every iteration.
+  // The pool holds at most one entry per concurrently live grid graph.
+  struct Storage
+  {
+    frVector<Node> nodes;
+    frVector<MarkerCosts> markerCosts;
+    frVector<NDRCosts> ndrCosts;
+    std::vector<bool> prevDirs;
+    std::vector<bool> srcs;
+    std::vector<bool> dsts;
+    std::vector<bool> guides;
+  };
+  static std::mutex spare_storage_mutex_;
+  static std::vector<Storage> spare_storage_;
+
   frVector<Node> nodes_;
+  frVector<MarkerCosts> markerCosts_;
+  frVector<NDRCosts> ndrCosts_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
   std::vector<bool> dsts_;
@@ -1102,6 +1147,26 @@ class FlexGridGraph
 
   FlexGridGraph() = default;
 
+  void stashStorage();
+  void reuseStorage();
+
+  MarkerCosts& getMarkerCosts(frMIdx idx)
+  {
+    if (markerCosts_.empty()) {
+      allocMarkerCosts();
+    }
+    return markerCosts_[idx];
+  }
+  NDRCosts& getNDRCosts(frMIdx idx)
+  {
+    if (ndrCosts_.empty()) {
+      allocNDRCosts();
+    }
+    return ndrCosts_[idx];
+  }
+  void allocMarkerCosts();
+  void allocNDRCosts();
+
   // unsafe access, no idx check
   void setPrevAstarNodeDir(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
@@ -1326,6 +1391,8 @@ class FlexGridGraph
     }
     (ar) & drWorker_;
     (ar) & nodes_;
+    (ar) & markerCosts_;
+    (ar) & ndrCosts_;
     (ar) & prevDirs_;
     (ar) & srcs_;
     (ar) & dsts_;
@@ -32,6 +32,8 @@
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/geometries/register/box.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+#include <vector>
 
 #include "db/infra/frBox.h"
 #include "db/infra/frPoint.h"
@@ -55,4 +57,15 @@ namespace drt {
 template <typename T, typename Key = Rect>
 using RTree = bgi::rtree<std::pair<Key, T>, bgi::quadratic<16>>;
 
+// Output iterator for RTree queries that appends only the value of each
+// matched (box, value) pair to result.  Queries that return bare pointers
+// use it to write straight into the caller's buffer instead of collecting
+// the pairs in a temporary vector first.
+template <typename T>
+auto valueInserter(std::vector<T>& result)
+{
+  return boost::make_function_output_iterator(
+      [&result](const auto& kv) { result.push_back(kv.second); });
+}
+
 }  // namespace drt
@@ -611,23 +611,16 @@ void frRegionQuery::queryGuide(const Rect& box,
                                const frLayerNum layerNum,
                                std::vector<frGuide*>& result) const
 {
-  Objects<frGuide> temp;
-  queryGuide(box, layerNum, temp);
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->guides_.at(layerNum).query(bgi::intersects(box),
+                                    valueInserter(result));
 }
 
 void frRegionQuery::queryGuide(const Rect& box,
                                std::vector<frGuide*>& result) const
 {
-  Objects<frGuide> temp;
   for (auto& m : impl_->guides_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), valueInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::queryOrigGuide(const Rect& box,
@@ -641,11 +634,7 @@ void frRegionQuery::queryOrigGuide(const Rect& box,
 void frRegionQuery::queryGRPin(const Rect& box,
                                std::vector<frBlockObject*>& result) const
 {
-  Objects<frBlockObject> temp;
-  impl_->grPins_.query(bgi::intersects(box), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->grPins_.query(bgi::intersects(box), valueInserter(result));
 }
 
 void frRegionQuery::queryDRObj(const box_t& boostb,
@@ -668,58 +657,40 @@ void frRegionQuery::queryDRObj(const Rect& box,
                                const frLayerNum layerNum,
                                std::vector<frBlockObject*>& result) const
 {
-  Objects<frBlockObject> temp;
-  impl_->drObjs_.at(layerNum).query(bgi::intersects(box), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->drObjs_.at(layerNum).query(bgi::intersects(box),
+                                    valueInserter(result));
 }
 
 void frRegionQuery::queryDRObj(const Rect& box,
                                std::vector<frBlockObject*>& result) const
 {
-  Objects<frBlockObject> temp;
   for (auto& m : impl_->drObjs_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), valueInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::queryGRObj(const Rect& box,
                                std::vector<grBlockObject*>& result) const
 {
-  Objects<grBlockObject> temp;
   for (auto& m : impl_->grObjs_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), valueInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::queryMarker(const Rect& box,
                                 const frLayerNum layerNum,
                                 std::vector<frMarker*>& result) const
 {
-  Objects<frMarker> temp;
-  impl_->markers_.at(layerNum).query(bgi::intersects(box), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  impl_->markers_.at(layerNum).query(bgi::intersects(box),
+                                     valueInserter(result));
 }
 
 void frRegionQuery::queryMarker(const Rect& box,
                                 std::vector<frMarker*>& result) const
 {
-  Objects<frMarker> temp;
   for (auto& m : impl_->markers_) {
-    m.query(bgi::intersects(box), back_inserter(temp));
+    m.query(bgi::intersects(box), valueInserter(result));
   }
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
 }
 
 void frRegionQuery::init()
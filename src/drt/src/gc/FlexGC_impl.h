@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "db/gcObj/gcNet.h"
@@ -154,6 +155,40 @@ class FlexGCWorker::Impl
 
   // temps
   std::vector<drNet*> modifiedDRNets_;
+  // flat copy of the rects found by one metal spacing query and of the
+  // per-rect inputs of checkMetalSpacing_prl_getReqSpcVal
+  struct SpacingCandidates
+  {
+    std::vector<frCoord> xl;
+    std::vector<frCoord> yl;
+    std::vector<frCoord> xh;
+    std::vector<frCoord> yh;
+    std::vector<frCoord> width;
+    std::vector<frCoord> ndrSpc;
+    std::vector<intptr_t> net;
+    std::vector<char> isObs;
+    std::vector<char> isFixed;
+    std::vector<char> keep;
+  };
+  SpacingCandidates spcCandidates_;
+  // flat copy of the PRL spacing rules of a layer
+  struct LayerSpacingRules
+  {
+    bool isInit = false;
+    // false if the layer's min spacing is not a PRL spacing table
+    bool isFlat = false;
+    std::vector<frCoord> widths;
+    std::vector<frCoord> prls;
+    std::vector<frCoord> spacings;  // widths.size() rows of prls.size()
+    frCoord minSpacing = 0;
+    bool hasSamenet = false;
+    bool samenetPGOnly = false;
+    frCoord samenetSpacing = 0;
+    std::vector<frCoord> rangeMinWidths;
+    std::vector<frCoord> rangeMaxWidths;
+    std::vector<frCoord> rangeSpacings;
+  };
+  std::vector<LayerSpacingRules> layerSpcRules_;
 
   // parameters
   gcNet* targetNet_;
@@ -227,6 +262,17 @@ class FlexGCWorker::Impl
   void checkMetalSpacing_wrongDir(gcPin* pin, frLayer* layer);
   frCoord checkMetalSpacing_getMaxSpcVal(frLayerNum layerNum,
                                          bool checkNDRs = true);
+  frCoord checkMetalSpacing_getMaxReqSpcVal(frLayerNum layerNum,
+                                            bool checkNDRs);
+  const LayerSpacingRules& checkMetalSpacing_getLayerRules(
+      frLayerNum layerNum);
+  frCoord checkMetalSpacing_getRuleWidth(gcRect* rect);
+  frCoord checkMetalSpacing_getNdrSpcVal(gcRect* rect);
+  template <typename T>
+  void checkMetalSpacing_filter(gcRect* rect,
+                                std::vector<rq_box_value_t<T>>& result,
+                                bool checkNDRs,
+                                frCoord maxReqSpcVal);
   void myBloat(const gtl::rectangle_data<frCoord>& rect,
                frCoord val,
                box_t& box);
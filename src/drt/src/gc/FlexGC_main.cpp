@@ -158,6 +158,28 @@ frCoord FlexGCWorker::Impl::checkMetalSpacing_getMaxSpcVal(frLayerNum layerNum,
   return maxSpcVal;
 }
 
+// Upper bound of checkMetalSpacing_prl_getReqSpcVal over every rect pair on
+// the layer.
+frCoord FlexGCWorker::Impl::checkMetalSpacing_getMaxReqSpcVal(
+    frLayerNum layerNum,
+    bool checkNDRs)
+{
+  auto maxSpcVal = checkMetalSpacing_getMaxSpcVal(layerNum, checkNDRs);
+  if (checkNDRs) {
+    maxSpcVal = std::max(maxSpcVal,
+                         getTech()->getMaxNondefaultSpacing(layerNum / 2 - 1));
+  }
+  auto currLayer = getTech()->getLayer(layerNum);
+  if (currLayer->hasSpacingSamenet()) {
+    maxSpcVal = std::max(maxSpcVal,
+                         currLayer->getSpacingSamenet()->getMinSpacing());
+  }
+  for (const auto& con : currLayer->getSpacingRangeConstraints()) {
+    maxSpcVal = std::max(maxSpcVal, con->getMinSpacing());
+  }
+  return maxSpcVal;
+}
+
 void FlexGCWorker::Impl::checkMetalCornerSpacing_getMaxSpcVal(
     frLayerNum layerNum,
     frCoord& maxSpcValX,
@@ -262,28 +284,11 @@ frCoord FlexGCWorker::Impl::checkMetalSpacing_prl_getReqSpcVal(gcRect* rect1,
   auto layerNum = rect1->getLayerNum();
   frCoord reqSpcVal = 0;
   auto currLayer = getTech()->getLayer(layerNum);
-  bool isObs = false;
-  auto width1 = rect1->width();
-  auto width2 = rect2->width();
   // override width and spacing
-  if (rect1->getNet()->isBlockage()) {
-    isObs = true;
-    if (USEMINSPACING_OBS) {
-      width1 = currLayer->getWidth();
-    }
-    if (rect1->getNet()->getDesignRuleWidth() != -1) {
-      width1 = rect1->getNet()->getDesignRuleWidth();
-    }
-  }
-  if (rect2->getNet()->isBlockage()) {
-    isObs = true;
-    if (USEMINSPACING_OBS) {
-      width2 = currLayer->getWidth();
-    }
-    if (rect2->getNet()->getDesignRuleWidth() != -1) {
-      width2 = rect2->getNet()->getDesignRuleWidth();
-    }
-  }
+  const bool isObs
+      = rect1->getNet()->isBlockage() || rect2->getNet()->isBlockage();
+  auto width1 = checkMetalSpacing_getRuleWidth(rect1);
+  auto width2 = checkMetalSpacing_getRuleWidth(rect2);
   // check if width is a result of route shape
   // if the width a shape is smaller if only using fixed shape, then it's route
   // shape -- wrong...
@@ -447,16 +452,9 @@ void FlexGCWorker::Impl::checkMetalSpacing_prl(
   auto reqSpcVal
       = checkMetalSpacing_prl_getReqSpcVal(rect1, rect2, prl, isSpcRange);
   if (checkNDRs) {
-    frCoord ndrSpc1 = 0, ndrSpc2 = 0;
-    if (!rect1->isFixed() && net1->isNondefault() && !rect1->isTapered()) {
-      ndrSpc1
-          = net1->getFrNet()->getNondefaultRule()->getSpacing(layerNum / 2 - 1);
-    }
-    if (!rect2->isFixed() && net2->isNondefault() && !rect2->isTapered()) {
-      ndrSpc2
-          = net2->getFrNet()->getNondefaultRule()->getSpacing(layerNum / 2 - 1);
-    }
-    reqSpcVal = std::max(reqSpcVal, std::max(ndrSpc1, ndrSpc2));
+    reqSpcVal = std::max(reqSpcVal,
+                         std::max(checkMetalSpacing_getNdrSpcVal(rect1),
+                                  checkMetalSpacing_getNdrSpcVal(rect2)));
   }
 
   // no violation if spacing satisfied
@@ -844,6 +842,214 @@ void FlexGCWorker::Impl::checkMetalSpacing_main(gcRect* rect1,
   }
 }
 
+const FlexGCWorker::Impl::LayerSpacingRules&
+FlexGCWorker::Impl::checkMetalSpacing_getLayerRules(frLayerNum layerNum)
+{
+  if ((int) layerSpcRules_.size() <= layerNum) {
+    layerSpcRules_.resize(layerNum + 1);
+  }
+  auto& rules = layerSpcRules_[layerNum];
+  if (rules.isInit) {
+    return rules;
+  }
+  rules.isInit = true;
+  auto currLayer = getTech()->getLayer(layerNum);
+  if (!currLayer->hasMinSpacing()) {
+    rules.isFlat = true;
+    rules.widths.push_back(0);
+    rules.prls.push_back(0);
+    rules.spacings.push_back(0);
+  } else if (currLayer->getMinSpacing()->typeId()
+             == frConstraintTypeEnum::frcSpacingTablePrlConstraint) {
+    auto con = static_cast<frSpacingTablePrlConstraint*>(
+        currLayer->getMinSpacing());
+    auto tbl = con->getLookupTbl();
+    rules.isFlat = true;
+    rules.widths = tbl.getRows();
+    rules.prls = tbl.getCols();
+    for (const auto& row : tbl.getValues()) {
+      rules.spacings.insert(rules.spacings.end(), row.begin(), row.end());
+    }
+    rules.minSpacing = con->findMin();
+    if (currLayer->hasSpacingSamenet()) {
+      auto conSamenet = currLayer->getSpacingSamenet();
+      rules.hasSamenet = true;
+      rules.samenetPGOnly = conSamenet->hasPGonly();
+      rules.samenetSpacing = conSamenet->getMinSpacing();
+    }
+  }
+  for (const auto& con : currLayer->getSpacingRangeConstraints()) {
+    rules.rangeMinWidths.push_back(con->getMinWidth());
+    rules.rangeMaxWidths.push_back(con->getMaxWidth());
+    rules.rangeSpacings.push_back(con->getMinSpacing());
+  }
+  return rules;
+}
+
+// Width used to look up the spacing of rect; obstructions may override it.
+frCoord FlexGCWorker::Impl::checkMetalSpacing_getRuleWidth(gcRect* rect)
+{
+  auto width = rect->width();
+  auto net = rect->getNet();
+  if (net->isBlockage()) {
+    if (USEMINSPACING_OBS) {
+      width = getTech()->getLayer(rect->getLayerNum())->getWidth();
+    }
+    if (net->getDesignRuleWidth() != -1) {
+      width = net->getDesignRuleWidth();
+    }
+  }
+  return width;
+}
+
+frCoord FlexGCWorker::Impl::checkMetalSpacing_getNdrSpcVal(gcRect* rect)
+{
+  auto net = rect->getNet();
+  if (rect->isFixed() || !net->isNondefault() || rect->isTapered()) {
+    return 0;
+  }
+  return net->getFrNet()->getNondefaultRule()->getSpacing(
+      rect->getLayerNum() / 2 - 1);
+}
+
+static gcRect* getCandidateRect(gcRect* rect)
+{
+  return rect;
+}
+
+static gcRect* getCandidateRect(gcRect& rect)
+{
+  return &rect;
+}
+
+// Marks in spcCandidates_.keep the query results that checkMetalSpacing_prl
+// may report against rect: shorts, and pairs closer than their required
+// spacing.  The per-rect inputs of checkMetalSpacing_prl_getReqSpcVal are
+// copied into flat arrays first so that the PRL table lookup, the same-net
+// and range overrides and the distance test run in one branch-free loop.
+// Layers whose min spacing is not a PRL table only drop the pairs beyond
+// maxReqSpcVal.
+template <typename T>
+void FlexGCWorker::Impl::checkMetalSpacing_filter(
+    gcRect* rect,
+    std::vector<rq_box_value_t<T>>& result,
+    bool checkNDRs,
+    frCoord maxReqSpcVal)
+{
+  auto& cands = spcCandidates_;
+  const int size = result.size();
+  cands.xl.resize(size);
+  cands.yl.resize(size);
+  cands.xh.resize(size);
+  cands.yh.resize(size);
+  cands.width.resize(size);
+  cands.ndrSpc.resize(size);
+  cands.net.resize(size);
+  cands.isObs.resize(size);
+  cands.isFixed.resize(size);
+  cands.keep.resize(size);
+  for (int i = 0; i < size; i++) {
+    gcRect* cand = getCandidateRect(result[i].second);
+    const Rect& box = result[i].first;
+    cands.xl[i] = box.xMin();
+    cands.yl[i] = box.yMin();
+    cands.xh[i] = box.xMax();
+    cands.yh[i] = box.yMax();
+    cands.width[i] = checkMetalSpacing_getRuleWidth(cand);
+    cands.ndrSpc[i] = checkNDRs ? checkMetalSpacing_getNdrSpcVal(cand) : 0;
+    cands.net[i] = (intptr_t) cand->getNet();
+    cands.isObs[i] = cand->getNet()->isBlockage();
+    cands.isFixed[i] = cand->isFixed();
+  }
+  const frCoord xl = gtl::xl(*rect);
+  const frCoord yl = gtl::yl(*rect);
+  const frCoord xh = gtl::xh(*rect);
+  const frCoord yh = gtl::yh(*rect);
+  const frCoord* cxl = cands.xl.data();
+  const frCoord* cyl = cands.yl.data();
+  const frCoord* cxh = cands.xh.data();
+  const frCoord* cyh = cands.yh.data();
+  char* keep = cands.keep.data();
+
+  const auto& rules = checkMetalSpacing_getLayerRules(rect->getLayerNum());
+  if (!rules.isFlat) {
+    const int64_t maxReqSpcSq = (int64_t) maxReqSpcVal * maxReqSpcVal;
+#pragma omp simd
+    for (int i = 0; i < size; i++) {
+      const frCoord distX = std::max(0, std::max(cxl[i] - xh, xl - cxh[i]));
+      const frCoord distY = std::max(0, std::max(cyl[i] - yh, yl - cyh[i]));
+      const int64_t distSq = (int64_t) distX * distX + (int64_t) distY * distY;
+      keep[i] = (distSq == 0) | (distSq < maxReqSpcSq);
+    }
+    return;
+  }
+
+  const frCoord width1 = checkMetalSpacing_getRuleWidth(rect);
+  const frCoord ndrSpc1 = checkNDRs ? checkMetalSpacing_getNdrSpcVal(rect) : 0;
+  const intptr_t net1 = (intptr_t) rect->getNet();
+  const bool isObs1 = rect->getNet()->isBlockage();
+  const bool isFixed1 = rect->isFixed();
+  // the same-net override of checkMetalSpacing_prl_getReqSpcVal
+  const bool hasSamenet
+      = rules.hasSamenet
+        && (!rules.samenetPGOnly || isPG(rect->getNet()->getOwner()));
+  const frCoord samenetSpc = std::max(rules.samenetSpacing, rules.minSpacing);
+  const int numWidths = rules.widths.size();
+  const int numPrls = rules.prls.size();
+  const int numRanges = rules.rangeSpacings.size();
+  const frCoord* widths = rules.widths.data();
+  const frCoord* prls = rules.prls.data();
+  const frCoord* spacings = rules.spacings.data();
+  const frCoord* rangeMin = rules.rangeMinWidths.data();
+  const frCoord* rangeMax = rules.rangeMaxWidths.data();
+  const frCoord* rangeSpc = rules.rangeSpacings.data();
+  const frCoord* cwidth = cands.width.data();
+  const frCoord* cndrSpc = cands.ndrSpc.data();
+  const intptr_t* cnet = cands.net.data();
+  const char* cisObs = cands.isObs.data();
+  const char* cisFixed = cands.isFixed.data();
+#pragma omp simd
+  for (int i = 0; i < size; i++) {
+    const frCoord distX = std::max(0, std::max(cxl[i] - xh, xl - cxh[i]));
+    const frCoord distY = std::max(0, std::max(cyl[i] - yh, yl - cyh[i]));
+    // the larger overlap, or minus the gap when the rects are apart
+    const frCoord prl
+        = std::max(std::min(xh, cxh[i]) - std::max(xl, cxl[i]),
+                   std::min(yh, cyh[i]) - std::max(yl, cyl[i]));
+    // fr2DLookupTbl::find: the last row and column below the key, or 0
+    const frCoord width = std::max(width1, cwidth[i]);
+    int row = -1;
+    for (int k = 0; k < numWidths; k++) {
+      row += widths[k] < width;
+    }
+    int col = -1;
+    for (int k = 0; k < numPrls; k++) {
+      col += prls[k] < prl;
+    }
+    frCoord reqSpcVal
+        = spacings[std::max(row, 0) * numPrls + std::max(col, 0)];
+    const bool sameNet = cnet[i] == net1;
+    if (hasSamenet & sameNet & !(isObs1 | cisObs[i])) {
+      reqSpcVal = samenetSpc;
+    }
+    for (int k = 0; k < numRanges; k++) {
+      const bool inRange
+          = ((width1 >= rangeMin[k]) & (width1 <= rangeMax[k]))
+            | ((cwidth[i] >= rangeMin[k]) & (cwidth[i] <= rangeMax[k]));
+      if (!sameNet & inRange) {
+        reqSpcVal = std::max(reqSpcVal, rangeSpc[k]);
+      }
+    }
+    reqSpcVal = std::max(reqSpcVal, std::max(ndrSpc1, cndrSpc[i]));
+    const int64_t distSq = (int64_t) distX * distX + (int64_t) distY * distY;
+    const bool isShort = distSq == 0;
+    const bool bothFixed = isFixed1 & (cisFixed[i] != 0);
+    keep[i] = isShort
+              | (!bothFixed
+                 & (distSq < (int64_t) reqSpcVal * reqSpcVal));
+  }
+}
+
 void FlexGCWorker::Impl::checkMetalSpacing_main(gcRect* rect,
                                                 bool checkNDRs,
                                                 bool isSpcRect)
@@ -860,19 +1066,29 @@ void FlexGCWorker::Impl::checkMetalSpacing_main(gcRect* rect,
   box_t queryBox;
   myBloat(*rect, maxSpcVal, queryBox);
 
+  // pairs at least this far apart cannot violate any spacing rule
+  auto maxReqSpcVal = std::max(
+      maxSpcVal, checkMetalSpacing_getMaxReqSpcVal(layerNum, checkNDRs));
+
   auto& workerRegionQuery = getWorkerRegionQuery();
   std::vector<rq_box_value_t<gcRect*>> result;
   workerRegionQuery.queryMaxRectangle(queryBox, layerNum, result);
   if (checkNDRs) {
     std::vector<rq_box_value_t<gcRect>> resultS;
     workerRegionQuery.querySpcRectangle(queryBox, layerNum, resultS);
-    for (auto& [objBox, ptr] : resultS) {
-      checkMetalSpacing_main(rect, &ptr, checkNDRs, isSpcRect);
+    checkMetalSpacing_filter(rect, resultS, checkNDRs, maxReqSpcVal);
+    for (int i = 0; i < (int) resultS.size(); i++) {
+      if (spcCandidates_.keep[i]) {
+        checkMetalSpacing_main(rect, &resultS[i].second, checkNDRs, isSpcRect);
+      }
     }
   }
   // Short, metSpc, NSMetal here
-  for (auto& [objBox, ptr] : result) {
-    checkMetalSpacing_main(rect, ptr, checkNDRs, isSpcRect);
+  checkMetalSpacing_filter(rect, result, checkNDRs, maxReqSpcVal);
+  for (int i = 0; i < (int) result.size(); i++) {
+    if (spcCandidates_.keep[i]) {
+      checkMetalSpacing_main(rect, result[i].second, checkNDRs, isSpcRect);
+    }
   }
 }
 
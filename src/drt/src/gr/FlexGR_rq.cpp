@@ -189,13 +189,9 @@ void FlexGRWorkerRegionQuery::query(const Rect& box,
                                     const frLayerNum layerNum,
                                     std::vector<grConnFig*>& result) const
 {
-  std::vector<rq_box_value_t<grConnFig*>> temp;
   box_t boostb
       = box_t(point_t(box.xMin(), box.yMin()), point_t(box.xMax(), box.yMax()));
-  shapes_.at(layerNum).query(bgi::intersects(boostb), back_inserter(temp));
-  transform(temp.begin(), temp.end(), back_inserter(result), [](auto& kv) {
-    return kv.second;
-  });
+  shapes_.at(layerNum).query(bgi::intersects(boostb), valueInserter(result));
 }
 
 void FlexGRWorkerRegionQuery::query(
@@ -3020,26 +3020,80 @@ void io::Parser::readTechAndLibs(odb::dbDatabase* db)
   }
 }
 
-void io::Parser::updateDesign()
+void io::Parser::updateDesign(const std::set<std::string>& inst_names,
+                              const std::set<std::string>& net_names)
 {
+  debugPrint(logger_,
+             DRT,
+             "update_design",
+             1,
+             "Re-reading {} instances and {} nets.",
+             inst_names.size(),
+             net_names.size());
   auto block = db_->getChip()->getBlock();
-  getBlock()->removeDeletedInsts();
-  for (auto db_inst : block->getInsts()) {
-    auto inst = getBlock()->findInst(db_inst->getName());
-    if (inst == nullptr) {
+  auto regionQuery = design_->getRegionQuery();
+  // DesignCallBack applies moves and removals as they happen; new
+  // instances and master swaps are (re)created here.
+  for (const auto& name : inst_names) {
+    auto db_inst = block->findInst(name.c_str());
+    auto inst = getBlock()->findInst(name);
+    if (inst != nullptr) {
+      if (db_inst != nullptr
+          && inst->getMaster()->getName() == db_inst->getMaster()->getName()) {
+        continue;
+      }
+      regionQuery->removeBlockObj(inst);
+      getBlock()->removeInst(inst);
+    }
+    if (db_inst != nullptr) {
       setInst(db_inst);
+      regionQuery->addBlockObj(getBlock()->findInst(name));
     }
   }
-  for (auto db_net : block->getNets()) {
-    auto netIn = getBlock()->findNet(db_net->getName());
+  getBlock()->removeDeletedInsts();
+  for (auto& net : getBlock()->getNets()) {
+    net->clearRPins();
+    net->clearGuides();
+    net->clearOrigGuides();
+  }
+  for (auto& net : getBlock()->getSNets()) {
+    net->clearRPins();
+    net->clearGuides();
+    net->clearOrigGuides();
+  }
+  for (const auto& name : net_names) {
+    auto db_net = block->findNet(name.c_str());
+    auto netIn = getBlock()->findNet(name);
+    if (db_net == nullptr || netIn == nullptr) {
+      continue;
+    }
+    // Special net shapes are not read from the dbWire.
+    if (!db_net->isSpecial()) {
+      for (auto& shape : netIn->getShapes()) {
+        regionQuery->removeDRObj(shape.get());
+      }
+      for (auto& via : netIn->getVias()) {
+        regionQuery->removeDRObj(via.get());
+      }
+      for (auto& pwire : netIn->getPatchWires()) {
+        regionQuery->removeDRObj(pwire.get());
+      }
+      netIn->clearRoutes();
+    }
     netIn->clearConns();
-    netIn->clearRPins();
-    netIn->clearGuides();
-    netIn->clearOrigGuides();
     updateNetRouting(netIn, db_net);
+    if (!db_net->isSpecial()) {
+      for (auto& shape : netIn->getShapes()) {
+        regionQuery->addDRObj(shape.get());
+      }
+      for (auto& via : netIn->getVias()) {
+        regionQuery->addDRObj(via.get());
+      }
+      for (auto& pwire : netIn->getPatchWires()) {
+        regionQuery->addDRObj(pwire.get());
+      }
+    }
   }
-  design_->getRegionQuery()->init();
-  design_->getRegionQuery()->initDRObj();
 }
 
 frTechObject* io::Writer::getTech() const
@@ -31,6 +31,8 @@
 #include <boost/icl/interval_set.hpp>
 #include <list>
 #include <memory>
+#include <set>
+#include <string>
 
 #include "frDesign.h"
 
@@ -87,7 +89,10 @@ class Parser
   {
     return prefTrackPatterns_;
   }
-  void updateDesign();
+  // Re-reads the named instances and nets from the db.  Everything else,
+  // including the region query, is updated in place.
+  void updateDesign(const std::set<std::string>& inst_names,
+                    const std::set<std::string>& net_names);
 
  private:
   frBlock* getBlock() const { return design_->getTopBlock(); }
@@ -0,0 +1,34 @@
+# Check that check_drc after db edits, which re-reads only the edited nets
+# and reuses the unaffected tiles, reports the same markers as a check of
+# the whole design read again.
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def drc_test.def
+set drc_file [make_result_file drc_incremental.drc]
+drt::check_drc -output_file $drc_file
+
+set block [ord::get_db_block]
+set tech [ord::get_db_tech]
+# Move an instance by one site.
+set inst [$block findInst _345_]
+$inst setLocation 87400 78400
+# Re-encode a wire with a longer metal2 segment.
+set wire [[$block findNet _000_] getWire]
+set wire_encoder [odb::dbWireEncoder]
+$wire_encoder begin $wire
+$wire_encoder newPath [$tech findLayer metal2] "ROUTED"
+$wire_encoder addPoint 150670 150500
+$wire_encoder addPoint 150670 153460
+$wire_encoder end
+
+set_debug_level DRT update_design 1
+set incr_drc_file [make_result_file drc_incremental_incr.drc]
+drt::check_drc -output_file $incr_drc_file
+set_debug_level DRT update_design 0
+
+# Compare against a check of the design read again from the db.
+drt::clear_design_cmd
+set fresh_drc_file [make_result_file drc_incremental_fresh.drc]
+drt::check_drc -output_file $fresh_drc_file
+diff_files $incr_drc_file $fresh_drc_file
@@ -38,6 +38,7 @@
 #endif
 
 #include <boost/test/data/test_case.hpp>
+#include <chrono>
 #include <iostream>
 
 #include "fixture.h"
@@ -422,6 +423,78 @@ BOOST_DATA_TEST_CASE(spacing_prl,
   }
 }
 
+// Check violation for PRL spacing between diagonal shapes, where the
+// euclidean distance decides whether the pair is legal.
+BOOST_DATA_TEST_CASE(spacing_prl_diagonal, bdata::make({60, 80}), offset)
+{
+  // Setup
+  makeSpacingConstraint(2);
+
+  frNet* n1 = makeNet("n1");
+  frNet* n2 = makeNet("n2");
+
+  makePathseg(n1, 2, {0, 0}, {500, 0});
+  makePathseg(n2, 2, {500 + offset, 100 + offset}, {1000, 100 + offset});
+
+  runGC();
+
+  // Test the results
+  auto& markers = worker.getMarkers();
+
+  if (offset * offset * 2 >= 100 * 100) {
+    BOOST_TEST(markers.size() == 0);
+  } else {
+    BOOST_TEST(markers.size() == 1);
+    testMarker(markers[0].get(),
+               2,
+               frConstraintTypeEnum::frcSpacingTablePrlConstraint,
+               Rect(500, 50, 500 + offset, 50 + offset));
+  }
+}
+
+// Throughput of the PRL spacing check on a dense grid of legally spaced
+// wires.  Run with --log_level=message to see the rects/second figure.
+BOOST_AUTO_TEST_CASE(spacing_prl_throughput)
+{
+  // Setup
+  makeSpacingConstraint(2);
+
+  // Rows are 200 apart edge to edge, which is the required spacing for the
+  // full parallel run; wires in a row are 400 apart end to end.
+  const int rows = 60;
+  const int cols = 20;
+  for (int r = 0; r < rows; ++r) {
+    for (int c = 0; c < cols; ++c) {
+      const std::string name
+          = "n" + std::to_string(r) + "_" + std::to_string(c);
+      frNet* net = makeNet(name.c_str());
+      makePathseg(net, 2, {c * 1400, r * 300}, {c * 1400 + 1000, r * 300});
+    }
+  }
+
+  initRegionQuery();
+
+  const Rect work(-1000, -1000, cols * 1400 + 1000, rows * 300 + 1000);
+  worker.setExtBox(work);
+  worker.setDrcBox(work);
+  worker.init(design.get());
+
+  const auto start = std::chrono::steady_clock::now();
+  worker.main();
+  const std::chrono::duration<double> elapsed
+      = std::chrono::steady_clock::now() - start;
+
+  worker.end();
+
+  BOOST_TEST_MESSAGE("PRL spacing: " << rows * cols << " rects in "
+                                     << elapsed.count() << " s, "
+                                     << rows * cols / elapsed.count()
+                                     << " rects/s");
+
+  // Test the results
+  BOOST_TEST(worker.getMarkers().size() == 0);
+}
+
 // Check violation for spacing two widths with design rule width on macro
 // obstruction
 BOOST_DATA_TEST_CASE(design_rule_width, bdata::make({true, false}), legal)
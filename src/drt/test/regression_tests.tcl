@@ -10,6 +10,7 @@ record_tests {
   top_level_term
   top_level_term2
   drc_test
+  drc_incremental
   #drt_man_tcl_check
   #drt_readme_msgs_check
 }
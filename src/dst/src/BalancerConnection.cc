@@ -30,8 +30,8 @@
 
 #include <dst/JobMessage.h>
 
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/asio/post.hpp>
 #include <boost/bind/bind.hpp>
 #include <boost/serialization/export.hpp>
@@ -86,8 +86,8 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
     if (!JobMessage::serializeMsg(JobMessage::READ, msg, data)) {
       logger_->warn(utl::DST,
                     42,
-                    "Received malformed msg {} from port {}",
-                    data,
+                    "Received malformed msg of {} bytes from port {}",
+                    data.size(),
                     sock_.remote_endpoint().port());
       asio::write(sock_, asio::buffer("0"), error);
       sock_.close();
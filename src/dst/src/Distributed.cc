@@ -253,7 +253,10 @@ bool Distributed::sendJobMultiResult(JobMessage& msg,
     while (getNextMsg(resultStr, JobMessage::EOP, split)) {
       JobMessage tmp;
       if (!JobMessage::serializeMsg(JobMessage::READ, tmp, split)) {
-        logger_->error(utl::DST, 9999, "Problem in deserialize {}", split);
+        logger_->error(utl::DST,
+                       9999,
+                       "Problem in deserializing a {} byte result",
+                       split.size());
       } else {
         result.addJobDescription(std::move(tmp.getJobDescriptionRef()));
       }
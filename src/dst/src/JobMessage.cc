@@ -28,32 +28,23 @@
 
 #include "dst/JobMessage.h"
 
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/unique_ptr.hpp>
 #include <sstream>
 
+#include "PacketCodec.h"
 #include "dst/BalancerJobDescription.h"
 
 using namespace dst;
 
-template <class Archive>
-inline bool is_loading(const Archive& ar)
-{
-  return std::is_same<typename Archive::is_loading, boost::mpl::true_>::value;
-}
-
 template <class Archive>
 void JobMessage::serialize(Archive& ar, const unsigned int version)
 {
   (ar) & msg_type_;
   (ar) & job_type_;
   (ar) & desc_;
-  if (!is_loading(ar)) {
-    std::string eop = EOP;
-    (ar) & eop;
-  }
 }
 
 bool JobMessage::serializeMsg(SerializeType type,
@@ -62,17 +53,28 @@ bool JobMessage::serializeMsg(SerializeType type,
 {
   if (type == WRITE) {
     try {
-      std::ostringstream oarchive_stream;
-      boost::archive::text_oarchive archive(oarchive_stream);
+      std::ostringstream oarchive_stream(std::ios_base::binary);
+      boost::archive::binary_oarchive archive(oarchive_stream);
       archive << msg;
-      str = oarchive_stream.str();
+      PacketCodec::encode(oarchive_stream.str(), str);
+      str += EOP;
     } catch (const boost::archive::archive_exception& e) {
       return false;
     }
   } else {
+    const std::string eop = EOP;
+    if (str.size() < eop.size()
+        || str.compare(str.size() - eop.size(), eop.size(), eop) != 0) {
+      return false;
+    }
+    std::string payload;
+    if (!PacketCodec::decode(str.substr(0, str.size() - eop.size()),
+                             payload)) {
+      return false;
+    }
     try {
-      std::istringstream iarchive_stream(str);
-      boost::archive::text_iarchive archive(iarchive_stream);
+      std::istringstream iarchive_stream(payload, std::ios_base::binary);
+      boost::archive::binary_iarchive archive(iarchive_stream);
       archive >> msg;
     } catch (const boost::archive::archive_exception& e) {
       return false;
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2021, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "PacketCodec.h"
+
+#include <zlib.h>
+
+#include <cstdint>
+
+namespace dst::PacketCodec {
+
+namespace {
+
+constexpr char kMagic[] = {'D', 'S', 'T', 'Z'};
+constexpr unsigned char kCompressed = 0x1;
+// deflate cannot expand data by more than about 1032:1, so a larger
+// claimed size means a corrupt header.
+constexpr uint64_t kMaxRatio = 1032;
+
+void putSize(std::string& out, uint64_t size)
+{
+  for (int i = 0; i < 8; i++) {
+    out.push_back(static_cast<char>((size >> (8 * i)) & 0xff));
+  }
+}
+
+uint64_t getSize(const std::string& in, std::size_t pos)
+{
+  uint64_t size = 0;
+  for (int i = 0; i < 8; i++) {
+    size |= static_cast<uint64_t>(static_cast<unsigned char>(in[pos + i]))
+            << (8 * i);
+  }
+  return size;
+}
+
+}  // namespace
+
+void encode(const std::string& payload, std::string& packet)
+{
+  unsigned char flags = 0;
+  std::string body;
+  if (payload.size() >= kCompressThreshold) {
+    uLongf size = compressBound(payload.size());
+    body.resize(size);
+    if (compress2(reinterpret_cast<Bytef*>(body.data()),
+                  &size,
+                  reinterpret_cast<const Bytef*>(payload.data()),
+                  payload.size(),
+                  Z_BEST_SPEED)
+            == Z_OK
+        && size < payload.size()) {
+      body.resize(size);
+      flags |= kCompressed;
+    }
+  }
+  packet.clear();
+  packet.reserve(kHeaderSize + ((flags & kCompressed) ? body : payload).size());
+  packet.append(kMagic, sizeof(kMagic));
+  packet.push_back(static_cast<char>(kVersion));
+  packet.push_back(static_cast<char>(flags));
+  putSize(packet, payload.size());
+  packet.append((flags & kCompressed) ? body : payload);
+}
+
+bool decode(const std::string& packet, std::string& payload)
+{
+  if (packet.size() < kHeaderSize
+      || packet.compare(0, sizeof(kMagic), kMagic, sizeof(kMagic)) != 0
+      || static_cast<unsigned char>(packet[4]) != kVersion) {
+    return false;
+  }
+  const unsigned char flags = static_cast<unsigned char>(packet[5]);
+  const uint64_t raw_size = getSize(packet, 6);
+  if (!(flags & kCompressed)) {
+    if (raw_size != packet.size() - kHeaderSize) {
+      return false;
+    }
+    payload.assign(packet, kHeaderSize);
+    return true;
+  }
+  if (raw_size > (packet.size() - kHeaderSize) * kMaxRatio) {
+    return false;
+  }
+  payload.resize(raw_size);
+  uLongf size = raw_size;
+  if (uncompress(reinterpret_cast<Bytef*>(payload.data()),
+                 &size,
+                 reinterpret_cast<const Bytef*>(packet.data() + kHeaderSize),
+                 packet.size() - kHeaderSize)
+          != Z_OK
+      || size != raw_size) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace dst::PacketCodec
@@ -0,0 +1,101 @@
+#define BOOST_TEST_MODULE TestPacketCodec
+
+#include <boost/test/included/unit_test.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "PacketCodec.h"
+
+using namespace dst;
+
+namespace {
+
+// Stands in for a serialized worker: runs of binary rect records with
+// nearby coordinates, as frArchive produces for shapes on a track grid.
+std::string makeWorkerLikePayload(std::size_t size)
+{
+  std::string payload;
+  payload.reserve(size);
+  uint32_t seed = 1;
+  int32_t x = 0;
+  while (payload.size() < size) {
+    seed = seed * 1103515245 + 12345;
+    x += 140 * ((seed >> 16) % 8);
+    const int32_t record[5]
+        = {x, 2800, x + 140, 2800 + 1400, static_cast<int32_t>(seed % 4)};
+    payload.append(reinterpret_cast<const char*>(record), sizeof(record));
+  }
+  payload.resize(size);
+  return payload;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(small_payload_is_sent_raw)
+{
+  const std::string payload = "small control message";
+  std::string packet;
+  PacketCodec::encode(payload, packet);
+  BOOST_TEST(packet.size() == PacketCodec::kHeaderSize + payload.size());
+  std::string decoded;
+  BOOST_TEST(PacketCodec::decode(packet, decoded));
+  BOOST_TEST(decoded == payload);
+}
+
+BOOST_AUTO_TEST_CASE(large_payload_round_trips_compressed)
+{
+  const std::string payload = makeWorkerLikePayload(1 << 20);
+  std::string packet;
+  PacketCodec::encode(payload, packet);
+  BOOST_TEST(packet.size() < payload.size());
+  std::string decoded;
+  BOOST_TEST(PacketCodec::decode(packet, decoded));
+  BOOST_TEST(decoded == payload);
+}
+
+BOOST_AUTO_TEST_CASE(bad_packets_are_rejected)
+{
+  const std::string payload = makeWorkerLikePayload(4096);
+  std::string packet;
+  PacketCodec::encode(payload, packet);
+  std::string decoded;
+
+  BOOST_TEST(!PacketCodec::decode(packet.substr(0, 10), decoded));
+  BOOST_TEST(
+      !PacketCodec::decode(packet.substr(0, packet.size() - 1), decoded));
+
+  std::string bad_version = packet;
+  bad_version[4] = static_cast<char>(PacketCodec::kVersion + 1);
+  BOOST_TEST(!PacketCodec::decode(bad_version, decoded));
+
+  // A pre-versioning archive has no header at all.
+  BOOST_TEST(!PacketCodec::decode(payload, decoded));
+}
+
+BOOST_AUTO_TEST_CASE(throughput)
+{
+  const std::string payload = makeWorkerLikePayload(16 << 20);
+  std::string packet;
+  std::string decoded;
+  const auto start = std::chrono::steady_clock::now();
+  PacketCodec::encode(payload, packet);
+  const auto encoded = std::chrono::steady_clock::now();
+  BOOST_TEST(PacketCodec::decode(packet, decoded));
+  const auto end = std::chrono::steady_clock::now();
+  BOOST_TEST(decoded == payload);
+
+  const double mb = payload.size() / 1e6;
+  const std::chrono::duration<double> encode_time = encoded - start;
+  const std::chrono::duration<double> decode_time = end - encoded;
+  BOOST_TEST_MESSAGE("payload " << payload.size() << " bytes, packet "
+                                << packet.size() << " bytes (ratio "
+                                << double(payload.size()) / packet.size()
+                                << "), encode " << mb / encode_time.count()
+                                << " MB/s, decode "
+                                << mb / decode_time.count() << " MB/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -33,6 +33,9 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -42,27 +45,29 @@
 
 namespace gpl {
 
-FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
+FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY, int numThreads)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
-      binSizeY_(binSizeY)
+      binSizeY_(binSizeY),
+      numThreads_(std::max(numThreads, 1))
 {
   binDensity_ = new float*[binCntX_];
   electroPhi_ = new float*[binCntX_];
   electroForceX_ = new float*[binCntX_];
   electroForceY_ = new float*[binCntX_];
 
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i] = new float[binCntY_];
-    electroPhi_[i] = new float[binCntY_];
-    electroForceX_[i] = new float[binCntY_];
-    electroForceY_[i] = new float[binCntY_];
-
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] = electroPhi_[i][j] = electroForceX_[i][j]
-          = electroForceY_[i][j] = 0.0f;
-    }
+  const size_t binCnt = static_cast<size_t>(binCntX_) * binCntY_;
+  binDensity_[0] = new float[binCnt]();
+  electroPhi_[0] = new float[binCnt]();
+  electroForceX_[0] = new float[binCnt]();
+  electroForceY_[0] = new float[binCnt]();
+
+  for (int i = 1; i < binCntX_; i++) {
+    binDensity_[i] = binDensity_[i - 1] + binCntY_;
+    electroPhi_[i] = electroPhi_[i - 1] + binCntY_;
+    electroForceX_[i] = electroForceX_[i - 1] + binCntY_;
+    electroForceY_[i] = electroForceY_[i - 1] + binCntY_;
   }
 
   csTable_.resize(std::max(binCntX_, binCntY_) * 3 / 2, 0);
@@ -74,6 +79,16 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
 
   workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
 
+  // Build the cos/sin tables up front; the 1D transforms only read them
+  // afterwards, so they can be shared between threads.
+  const int n = std::max(binCntX_, binCntY_);
+  const int nw = n >> 2;
+  makewt(nw, workArea_.data(), csTable_.data());
+  makect(n, workArea_.data(), csTable_.data() + nw);
+
+  columnBuffer_.resize(
+      static_cast<size_t>(numThreads_) * kColumnBlock * binCntX_, 0);
+
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -90,25 +105,14 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
 
 FFT::~FFT()
 {
-  using std::vector;
-  for (int i = 0; i < binCntX_; i++) {
-    delete[] binDensity_[i];
-    delete[] electroPhi_[i];
-    delete[] electroForceX_[i];
-    delete[] electroForceY_[i];
-  }
+  delete[] binDensity_[0];
+  delete[] electroPhi_[0];
+  delete[] electroForceX_[0];
+  delete[] electroForceY_[0];
   delete[] binDensity_;
   delete[] electroPhi_;
   delete[] electroForceX_;
   delete[] electroForceY_;
-
-  csTable_.clear();
-  wx_.clear();
-  wxSquare_.clear();
-  wy_.clear();
-  wySquare_.clear();
-
-  workArea_.clear();
 }
 
 void FFT::updateDensity(int x, int y, float density)
@@ -126,15 +130,53 @@ float FFT::getElectroPhi(int x, int y) const
   return electroPhi_[x][y];
 }
 
+void FFT::transform2d(int isgn, float** a, bool rowSine, bool columnSine)
+{
+  int* ip = workArea_.data();
+  float* w = csTable_.data();
+
+#pragma omp parallel for num_threads(numThreads_) schedule(static)
+  for (int i = 0; i < binCntX_; i++) {
+    if (rowSine) {
+      ddst(binCntY_, isgn, a[i], ip, w);
+    } else {
+      ddct(binCntY_, isgn, a[i], ip, w);
+    }
+  }
+
+  const int blockCnt = (binCntY_ + kColumnBlock - 1) / kColumnBlock;
+#pragma omp parallel for num_threads(numThreads_) schedule(static)
+  for (int block = 0; block < blockCnt; block++) {
+    float* t = &columnBuffer_[static_cast<size_t>(omp_get_thread_num())
+                              * kColumnBlock * binCntX_];
+    const int j0 = block * kColumnBlock;
+    const int width = std::min(kColumnBlock, binCntY_ - j0);
+
+    for (int i = 0; i < binCntX_; i++) {
+      const float* row = a[i] + j0;
+      for (int k = 0; k < width; k++) {
+        t[k * binCntX_ + i] = row[k];
+      }
+    }
+    for (int k = 0; k < width; k++) {
+      if (columnSine) {
+        ddst(binCntX_, isgn, &t[k * binCntX_], ip, w);
+      } else {
+        ddct(binCntX_, isgn, &t[k * binCntX_], ip, w);
+      }
+    }
+    for (int i = 0; i < binCntX_; i++) {
+      float* row = a[i] + j0;
+      for (int k = 0; k < width; k++) {
+        row[k] = t[k * binCntX_ + i];
+      }
+    }
+  }
+}
+
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
+  transform2d(-1, binDensity_, false, false);
 
   for (int i = 0; i < binCntX_; i++) {
     binDensity_[i][0] *= 0.5;
@@ -144,17 +186,14 @@ void FFT::doFFT()
     binDensity_[0][i] *= 0.5;
   }
 
-  for (int i = 0; i < binCntX_; i++) {
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
-    }
-  }
-
+#pragma omp parallel for num_threads(numThreads_) schedule(static)
   for (int i = 0; i < binCntX_; i++) {
     float wx = wx_[i];
     float wx2 = wxSquare_[i];
 
     for (int j = 0; j < binCntY_; j++) {
+      binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
+
       float wy = wy_[j];
       float wy2 = wySquare_[j];
 
@@ -186,27 +225,11 @@ void FFT::doFFT()
     }
   }
   // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
+  transform2d(1, electroPhi_, false, false);
+  // equivalent to ddsct2d: DCT along rows, DST along columns
+  transform2d(1, electroForceX_, false, true);
+  // equivalent to ddcst2d: DST along rows, DCT along columns
+  transform2d(1, electroForceY_, true, false);
 }
 
 }  // namespace gpl
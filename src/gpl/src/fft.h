@@ -40,7 +40,11 @@ namespace gpl {
 class FFT
 {
  public:
-  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
+  FFT(int binCntX,
+      int binCntY,
+      int binSizeX,
+      int binSizeY,
+      int numThreads = 1);
   ~FFT();
 
   // input func
@@ -54,8 +58,17 @@ class FFT
   float getElectroPhi(int x, int y) const;
 
  private:
+  // 2D DCT/DST over a[binCntX_][binCntY_]. The row pass and the column
+  // pass are each split across numThreads_ threads; columns are gathered
+  // kColumnBlock at a time into a per thread buffer so that every 1D
+  // transform runs on contiguous memory.  Gives the same results as the
+  // serial ddct2d/ddsct2d/ddcst2d.
+  void transform2d(int isgn, float** a, bool rowSine, bool columnSine);
+
+  static constexpr int kColumnBlock = 8;
+
   // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
+  // Rows point into a single contiguous allocation.
   float** binDensity_ = nullptr;
   float** electroPhi_ = nullptr;
   float** electroForceX_ = nullptr;
@@ -77,10 +90,14 @@ class FFT
   // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
   std::vector<int> workArea_;
 
+  // column gather buffers. length: numThreads_ * kColumnBlock * binCntX_
+  std::vector<float> columnBuffer_;
+
   int binCntX_ = 0;
   int binCntY_ = 0;
   int binSizeX_ = 0;
   int binSizeY_ = 0;
+  int numThreads_ = 1;
 };
 
 //
@@ -92,6 +109,8 @@ class FFT
 void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
+void makewt(int nw, int* ip, float* w);
+void makect(int nc, int* ip, float* c);
 
 /// 2D FFT ////////////////////////////////////////////////////////////////
 void cdft2d(int, int, int, float**, float*, int*, float*);
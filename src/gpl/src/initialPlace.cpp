@@ -54,14 +54,21 @@ void InitialPlaceVars::reset()
   maxSolverIter = 100;
   maxFanout = 200;
   netWeightScale = 800.0;
+  solver = InitialPlaceSolver::BICGSTAB;
+  updateInPlace = false;
   debug = false;
 }
 
 InitialPlace::InitialPlace(InitialPlaceVars ipVars,
                            std::shared_ptr<PlacerBaseCommon> pbc,
                            std::vector<std::shared_ptr<PlacerBase>>& pbVec,
-                           utl::Logger* log)
-    : ipVars_(ipVars), pbc_(std::move(pbc)), pbVec_(pbVec), log_(log)
+                           utl::Logger* log,
+                           int num_threads)
+    : ipVars_(ipVars),
+      pbc_(std::move(pbc)),
+      pbVec_(pbVec),
+      log_(log),
+      num_threads_(num_threads)
 {
 }
 
@@ -84,6 +91,8 @@ void InitialPlace::doBicgstabPlace()
     createSparseMatrix();
     error = cpuSparseSolve(ipVars_.maxSolverIter,
                            iter,
+                           num_threads_,
+                           ipVars_.solver,
                            placeInstForceMatrixX_,
                            fixedInstForceVecX_,
                            instLocVecX_,
@@ -160,14 +169,19 @@ void InitialPlace::setPlaceInstExtId()
 void InitialPlace::updatePinInfo()
 {
   // reset all MinMax attributes
-  for (auto& pin : pbc_->pins()) {
+#pragma omp parallel for num_threads(num_threads_)
+  for (auto it = pbc_->pins().begin(); it < pbc_->pins().end(); ++it) {
+    Pin* pin = *it;  // old-style loop for old OpenMP
     pin->unsetMinPinX();
     pin->unsetMinPinY();
     pin->unsetMaxPinX();
     pin->unsetMaxPinY();
   }
 
-  for (auto& net : pbc_->nets()) {
+  // Each pin belongs to a single net, so nets can be marked independently.
+#pragma omp parallel for num_threads(num_threads_)
+  for (auto it = pbc_->nets().begin(); it < pbc_->nets().end(); ++it) {
+    Net* net = *it;  // old-style loop for old OpenMP
     Pin *pinMinX = nullptr, *pinMinY = nullptr;
     Pin *pinMaxX = nullptr, *pinMaxY = nullptr;
     int lx = INT_MAX, ly = INT_MAX;
@@ -224,8 +238,11 @@ void InitialPlace::createSparseMatrix()
   instLocVecY_.resize(placeCnt);
   fixedInstForceVecY_.resize(placeCnt);
 
-  placeInstForceMatrixX_.resize(placeCnt, placeCnt);
-  placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  // resize() drops the entries that updateSparseMatrix reuses.
+  if (placeInstForceMatrixX_.rows() != placeCnt) {
+    placeInstForceMatrixX_.resize(placeCnt, placeCnt);
+    placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  }
 
   //
   // listX and listY is a temporary vector that have tuples, (idx1, idx2, val)
@@ -237,9 +254,10 @@ void InitialPlace::createSparseMatrix()
   // to fill in SparseMatrix from Eigen docs.
   //
 
-  std::vector<T> listX, listY;
-  listX.reserve(1000000);
-  listY.reserve(1000000);
+  std::vector<T>& listX = listX_;
+  std::vector<T>& listY = listY_;
+  listX.clear();
+  listY.clear();
 
   // initialize vector
   for (auto& inst : pbc_->placeInsts()) {
@@ -389,8 +407,31 @@ void InitialPlace::createSparseMatrix()
     }
   }
 
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+  if (ipVars_.updateInPlace) {
+    updateSparseMatrix(placeInstForceMatrixX_, listX);
+    updateSparseMatrix(placeInstForceMatrixY_, listY);
+  } else {
+    placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
+    placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+  }
+}
+
+// Accumulates the triplets into the entries the matrix already has instead
+// of sorting them into a new matrix.  Missing entries are inserted and
+// entries no longer used stay as explicit zeros, so the pattern only grows
+// and the products give the same values as a rebuilt matrix.
+void InitialPlace::updateSparseMatrix(SMatrix& matrix,
+                                      const std::vector<T>& list)
+{
+  if (matrix.nonZeros() == 0) {
+    matrix.setFromTriplets(list.begin(), list.end());
+    return;
+  }
+  matrix.coeffs().setZero();
+  for (const T& triplet : list) {
+    matrix.coeffRef(triplet.row(), triplet.col()) += triplet.value();
+  }
+  matrix.makeCompressed();
 }
 
 void InitialPlace::updateCoordi()
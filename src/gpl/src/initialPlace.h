@@ -36,6 +36,7 @@
 #include <Eigen/SparseCore>
 #include <memory>
 
+#include "gpl/Replace.h"
 #include "nesterovPlace.h"
 #include "odb/db.h"
 
@@ -57,6 +58,9 @@ class InitialPlaceVars
   int maxSolverIter;
   int maxFanout;
   float netWeightScale;
+  InitialPlaceSolver solver;
+  // Update the matrix values in place when the pattern allows it.
+  bool updateInPlace;
   bool debug;
 
   InitialPlaceVars();
@@ -71,7 +75,8 @@ class InitialPlace
   InitialPlace(InitialPlaceVars ipVars,
                std::shared_ptr<PlacerBaseCommon> pbc,
                std::vector<std::shared_ptr<PlacerBase>>& pbVec,
-               utl::Logger* logger);
+               utl::Logger* logger,
+               int num_threads = 1);
   void doBicgstabPlace();
 
  private:
@@ -79,6 +84,7 @@ class InitialPlace
   std::shared_ptr<PlacerBaseCommon> pbc_;
   std::vector<std::shared_ptr<PlacerBase>> pbVec_;
   utl::Logger* log_ = nullptr;
+  int num_threads_ = 1;
 
   // Solve two SparseMatrix equations here;
   //
@@ -110,10 +116,16 @@ class InitialPlace
   Eigen::VectorXf instLocVecY_, fixedInstForceVecY_;
   SMatrix placeInstForceMatrixX_, placeInstForceMatrixY_;
 
+  // Triplet buffers for the matrices above, kept so their capacity is
+  // reused between iterations.
+  std::vector<Eigen::Triplet<float>> listX_, listY_;
+
   void placeInstsCenter();
   void setPlaceInstExtId();
   void updatePinInfo();
   void createSparseMatrix();
+  static void updateSparseMatrix(SMatrix& matrix,
+                                 const std::vector<Eigen::Triplet<float>>& list);
   void updateCoordi();
 };
 
@@ -46,6 +46,7 @@
 #include "odb/db.h"
 #include "placerBase.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 #define REPLACE_SQRT2 1.414213562373095048801L
 
@@ -1025,6 +1026,9 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
   assert(omp_get_thread_num() == 0);
+  const utl::DebugScopedTimer timer(
+      log_, GPL, "timer", 1, "WA wirelength force: {}");
+  const bool debugWa = log_->debugCheck(GPL, "wlUpdateWA", 1);
   // clear all WA variables.
 #pragma omp parallel for num_threads(num_threads_)
   for (auto gPin = gPinStor_.begin(); gPin < gPinStor_.end(); ++gPin) {
@@ -1032,7 +1036,8 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
     gPin->clearWaVars();
   }
 
-#pragma omp parallel for num_threads(num_threads_)
+  // Pin counts vary widely between nets, so hand them out dynamically.
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 256)
   for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
     // old-style loop for old OpenMP
 
@@ -1057,7 +1062,7 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
         gPin->setMinExpSumX(fastExp(expMinX));
         gNet->addWaExpMinSumX(gPin->minExpSumX());
         gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
+        if (debugWa && gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
                      "wlUpdateWA",
@@ -1073,7 +1078,7 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
         gPin->setMaxExpSumX(fastExp(expMaxX));
         gNet->addWaExpMaxSumX(gPin->maxExpSumX());
         gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
+        if (debugWa && gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
                      "wlUpdateWA",
@@ -1089,7 +1094,7 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
         gPin->setMinExpSumY(fastExp(expMinY));
         gNet->addWaExpMinSumY(gPin->minExpSumY());
         gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
+        if (debugWa && gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
                      "wlUpdateWA",
@@ -1105,7 +1110,7 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
         gPin->setMaxExpSumY(fastExp(expMaxY));
         gNet->addWaExpMaxSumY(gPin->maxExpSumY());
         gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
+        if (debugWa && gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
                      "wlUpdateWA",
@@ -1342,8 +1347,11 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   bg_.initBins();
 
   // initialize fft structrue based on bins
-  std::unique_ptr<FFT> fft(
-      new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  std::unique_ptr<FFT> fft(new FFT(bg_.binCntX(),
+                                   bg_.binCntY(),
+                                   bg_.binSizeX(),
+                                   bg_.binSizeY(),
+                                   nbc_->getNumThreads()));
 
   fft_ = std::move(fft);
 
@@ -1952,6 +1960,7 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
   if (isConverged_) {
     return;
   }
+  const utl::DebugScopedTimer timer(log_, GPL, "timer", 1, "Gradients: {}");
 
   wireLengthGradSum_ = 0;
   densityGradSum_ = 0;
@@ -1961,28 +1970,17 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
   debugPrint(
       log_, GPL, "updateGrad", 1, "DensityPenalty: {:g}", densityPenalty_);
 
-  // TODO: This OpenMP parallel section is causing non-determinism. Consider
-  // revisiting this in the future to restore determinism.
-  //#pragma omp parallel for num_threads(nbc_->getNumThreads()) reduction(+ :
-  // wireLengthGradSum_, densityGradSum_, gradSum)
+  // The per cell gradients are independent, so they are computed in
+  // parallel.  The sums are accumulated afterwards in cell order to keep
+  // the result independent of the thread count.
+#pragma omp parallel for num_threads(nbc_->getNumThreads()) \
+    schedule(dynamic, 256)
   for (size_t i = 0; i < gCells_.size(); i++) {
-    GCell* gCell = gCells_.at(i);
+    GCell* gCell = gCells_[i];
     wireLengthGrads[i]
         = nbc_->getWireLengthGradientWA(gCell, wlCoeffX, wlCoeffY);
     densityGrads[i] = getDensityGradient(gCell);
 
-    // Different compiler has different results on the following formula.
-    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
-    //
-    // To prevent instability problem,
-    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
-    //
-    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].x);
-    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].y);
-
-    densityGradSum_ += std::fabs(densityGrads[i].x);
-    densityGradSum_ += std::fabs(densityGrads[i].y);
-
     sumGrads[i].x = wireLengthGrads[i].x + densityPenalty_ * densityGrads[i].x;
     sumGrads[i].y = wireLengthGrads[i].y + densityPenalty_ * densityGrads[i].y;
 
@@ -2003,6 +2001,20 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
 
     sumGrads[i].x /= sumPrecondi.x;
     sumGrads[i].y /= sumPrecondi.y;
+  }
+
+  for (size_t i = 0; i < gCells_.size(); i++) {
+    // Different compiler has different results on the following formula.
+    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
+    //
+    // To prevent instability problem,
+    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
+    //
+    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].x);
+    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].y);
+
+    densityGradSum_ += std::fabs(densityGrads[i].x);
+    densityGradSum_ += std::fabs(densityGrads[i].y);
 
     gradSum += std::fabs(sumGrads[i].x) + std::fabs(sumGrads[i].y);
   }
@@ -92,6 +92,8 @@ void Replace::reset()
   initialPlaceMaxSolverIter_ = 100;
   initialPlaceMaxFanout_ = 200;
   initialPlaceNetWeightScale_ = 800;
+  initialPlaceSolver_ = InitialPlaceSolver::BICGSTAB;
+  initialPlaceUpdateInPlace_ = false;
 
   nesterovPlaceMaxIter_ = 5000;
   binGridCntX_ = binGridCntY_ = 0;
@@ -190,7 +192,7 @@ void Replace::doIncrementalPlace(int threads)
   constexpr float rough_oveflow = 0.2f;
   float previous_overflow = overflow_;
   setTargetOverflow(std::max(rough_oveflow, overflow_));
-  doInitialPlace();
+  doInitialPlace(threads);
 
   int previous_max_iter = nesterovPlaceMaxIter_;
   initNesterovPlace(threads);
@@ -210,7 +212,7 @@ void Replace::doIncrementalPlace(int threads)
   }
 }
 
-void Replace::doInitialPlace()
+void Replace::doInitialPlace(int threads)
 {
   if (pbc_ == nullptr) {
     PlacerBaseVars pbVars;
@@ -245,10 +247,12 @@ void Replace::doInitialPlace()
   ipVars.maxSolverIter = initialPlaceMaxSolverIter_;
   ipVars.maxFanout = initialPlaceMaxFanout_;
   ipVars.netWeightScale = initialPlaceNetWeightScale_;
+  ipVars.solver = initialPlaceSolver_;
+  ipVars.updateInPlace = initialPlaceUpdateInPlace_;
   ipVars.debug = gui_debug_initial_;
 
   std::unique_ptr<InitialPlace> ip(
-      new InitialPlace(ipVars, pbc_, pbVec_, log_));
+      new InitialPlace(ipVars, pbc_, pbVec_, log_, threads));
   ip_ = std::move(ip);
   ip_->doBicgstabPlace();
 }
@@ -402,6 +406,16 @@ void Replace::setInitialPlaceNetWeightScale(float scale)
   initialPlaceNetWeightScale_ = scale;
 }
 
+void Replace::setInitialPlaceSolver(InitialPlaceSolver solver)
+{
+  initialPlaceSolver_ = solver;
+}
+
+void Replace::setInitialPlaceUpdateInPlace(bool update_in_place)
+{
+  initialPlaceUpdateInPlace_ = update_in_place;
+}
+
 void Replace::setNesterovPlaceMaxIter(int iter)
 {
   nesterovPlaceMaxIter_ = iter;
@@ -33,7 +33,8 @@ void
 replace_initial_place_cmd()
 {
   Replace* replace = getReplace();
-  replace->doInitialPlace();
+  int threads = ord::OpenRoad::openRoad()->getThreadCount();
+  replace->doInitialPlace(threads);
 }
 
 void 
@@ -82,6 +83,27 @@ set_initial_place_max_fanout_cmd(int fanout)
   replace->setInitialPlaceMaxFanout(fanout);
 }
 
+void
+set_initial_place_solver_cmd(const char* solver)
+{
+  Replace* replace = getReplace();
+  const std::string name = solver;
+  if (name == "jacobi_cg") {
+    replace->setInitialPlaceSolver(gpl::InitialPlaceSolver::JACOBI_CG);
+  } else if (name == "ichol_cg") {
+    replace->setInitialPlaceSolver(gpl::InitialPlaceSolver::ICHOL_CG);
+  } else {
+    replace->setInitialPlaceSolver(gpl::InitialPlaceSolver::BICGSTAB);
+  }
+}
+
+void
+set_initial_place_update_in_place_cmd(bool update_in_place)
+{
+  Replace* replace = getReplace();
+  replace->setInitialPlaceUpdateInPlace(update_in_place);
+}
+
 void
 set_nesv_place_iter_cmd(int iter)
 {
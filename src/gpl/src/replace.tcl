@@ -50,6 +50,8 @@ sta::define_cmd_args "global_placement" {\
     [-overflow overflow]\
     [-initial_place_max_iter initial_place_max_iter]\
     [-initial_place_max_fanout initial_place_max_fanout]\
+    [-initial_place_solver bicgstab|jacobi_cg|ichol_cg]\
+    [-initial_place_update_in_place]\
     [-routability_use_grt]\
     [-routability_target_rc_metric routability_target_rc_metric]\
     [-routability_check_overflow routability_check_overflow]\
@@ -73,6 +75,7 @@ proc global_placement { args } {
       -min_phi_coef -max_phi_coef -overflow \
       -reference_hpwl \
       -initial_place_max_iter -initial_place_max_fanout \
+      -initial_place_solver \
       -routability_check_overflow -routability_max_density \
       -routability_max_bloat_iter -routability_max_inflation_iter \
       -routability_target_rc_metric \
@@ -91,6 +94,7 @@ proc global_placement { args } {
       -disable_timing_driven \
       -disable_routability_driven \
       -skip_io \
+      -initial_place_update_in_place \
       -incremental}
 
   # flow control for initial_place
@@ -174,6 +178,17 @@ proc global_placement { args } {
     gpl::set_initial_place_max_fanout_cmd $initial_place_max_fanout
   }
 
+  if { [info exists keys(-initial_place_solver)] } {
+    set initial_place_solver $keys(-initial_place_solver)
+    if { [lsearch -exact {bicgstab jacobi_cg ichol_cg} $initial_place_solver] == -1 } {
+      utl::error GPL 153 "-initial_place_solver must be bicgstab, jacobi_cg or ichol_cg."
+    }
+    gpl::set_initial_place_solver_cmd $initial_place_solver
+  }
+
+  gpl::set_initial_place_update_in_place_cmd \
+    [info exists flags(-initial_place_update_in_place)]
+
   # density settings
   set target_density 0.7
   set uniform_mode 0
@@ -35,10 +35,57 @@
 
 #include "solver.h"
 
+#include <omp.h>
+
+#include <algorithm>
+
+#include "utl/timer.h"
+
 namespace gpl {
 
+template <class Solver>
+static float solveAxis(int maxSolverIter,
+                       SMatrix& placeInstForceMatrix,
+                       Eigen::VectorXf& fixedInstForceVec,
+                       Eigen::VectorXf& instLocVec)
+{
+  Solver solver;
+  solver.setMaxIterations(maxSolverIter);
+  solver.compute(placeInstForceMatrix);
+  instLocVec = solver.solveWithGuess(fixedInstForceVec, instLocVec);
+  return solver.error();
+}
+
+// The B2B matrices are symmetric, so CG may use the whole matrix
+// (Lower | Upper), which keeps Eigen's multithreaded row-major product.
+static float solveAxis(InitialPlaceSolver solver,
+                       int maxSolverIter,
+                       SMatrix& placeInstForceMatrix,
+                       Eigen::VectorXf& fixedInstForceVec,
+                       Eigen::VectorXf& instLocVec)
+{
+  switch (solver) {
+    case InitialPlaceSolver::BICGSTAB:
+      return solveAxis<BiCGSTAB<SMatrix, IdentityPreconditioner>>(
+          maxSolverIter, placeInstForceMatrix, fixedInstForceVec, instLocVec);
+    case InitialPlaceSolver::JACOBI_CG:
+      return solveAxis<ConjugateGradient<SMatrix,
+                                         Eigen::Lower | Eigen::Upper,
+                                         DiagonalPreconditioner<float>>>(
+          maxSolverIter, placeInstForceMatrix, fixedInstForceVec, instLocVec);
+    case InitialPlaceSolver::ICHOL_CG:
+      return solveAxis<ConjugateGradient<SMatrix,
+                                         Eigen::Lower | Eigen::Upper,
+                                         IncompleteCholesky<float>>>(
+          maxSolverIter, placeInstForceMatrix, fixedInstForceVec, instLocVec);
+  }
+  return 0;
+}
+
 ResidualError cpuSparseSolve(int maxSolverIter,
                              int iter,
+                             int threads,
+                             InitialPlaceSolver solver,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
                              Eigen::VectorXf& instLocVecX,
@@ -47,16 +94,49 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              Eigen::VectorXf& instLocVecY,
                              utl::Logger* logger)
 {
+  const utl::DebugScopedTimer timer(
+      logger, GPL, "timer", 1, "Initial place solve: {}");
   ResidualError error;
-  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
-  solver.setMaxIterations(maxSolverIter);
-  solver.compute(placeInstForceMatrixX);
-  instLocVecX = solver.solveWithGuess(fixedInstForceVecX, instLocVecX);
-  error.x = solver.error();
+  const int eigen_threads = Eigen::nbThreads();
+  if (threads < 2) {
+    Eigen::setNbThreads(1);
+    error.x = solveAxis(solver,
+                        maxSolverIter,
+                        placeInstForceMatrixX,
+                        fixedInstForceVecX,
+                        instLocVecX);
+    error.y = solveAxis(solver,
+                        maxSolverIter,
+                        placeInstForceMatrixY,
+                        fixedInstForceVecY,
+                        instLocVecY);
+    Eigen::setNbThreads(eigen_threads);
+    return error;
+  }
 
-  solver.compute(placeInstForceMatrixY);
-  instLocVecY = solver.solveWithGuess(fixedInstForceVecY, instLocVecY);
-  error.y = solver.error();
+  // Eigen's row-major SpMV splits rows across threads, so the results do
+  // not depend on the thread count.  It needs a nested level to run
+  // inside the X/Y sections.
+  const int max_active_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(max_active_levels, 2));
+  Eigen::setNbThreads(std::max(threads / 2, 1));
+#pragma omp parallel sections num_threads(2)
+  {
+#pragma omp section
+    error.x = solveAxis(solver,
+                        maxSolverIter,
+                        placeInstForceMatrixX,
+                        fixedInstForceVecX,
+                        instLocVecX);
+#pragma omp section
+    error.y = solveAxis(solver,
+                        maxSolverIter,
+                        placeInstForceMatrixY,
+                        fixedInstForceVecY,
+                        instLocVecY);
+  }
+  omp_set_max_active_levels(max_active_levels);
+  Eigen::setNbThreads(eigen_threads);
   return error;
 }
 }  // namespace gpl
@@ -39,6 +39,7 @@
 #include <Eigen/SparseCore>
 #include <memory>
 
+#include "gpl/Replace.h"
 #include "graphics.h"
 #include "odb/db.h"
 #include "placerBase.h"
@@ -57,13 +58,21 @@ struct ResidualError
 };
 
 using Eigen::BiCGSTAB;
+using Eigen::ConjugateGradient;
+using Eigen::DiagonalPreconditioner;
 using Eigen::IdentityPreconditioner;
+using Eigen::IncompleteCholesky;
 using utl::GPL;
 
 using SMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
 
+// Solves the X and Y systems concurrently when more than one thread is
+// available; the remaining threads go to Eigen's sparse matrix-vector
+// products.
 ResidualError cpuSparseSolve(int maxSolverIter,
                              int iter,
+                             int threads,
+                             InitialPlaceSolver solver,
                              SMatrix& placeInstForceMatrixX,
                              Eigen::VectorXf& fixedInstForceVecX,
                              Eigen::VectorXf& instLocVecX,
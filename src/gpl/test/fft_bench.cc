@@ -0,0 +1,61 @@
+// Reports the time of one density solve (FFT::doFFT) versus bin count and
+// thread count.
+//
+// usage: fft_bench [max_threads] [iterations]
+
+#include <omp.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "spdlog/fmt/fmt.h"
+#include "src/gpl/src/fft.h"
+
+int main(int argc, char* argv[])
+{
+  const int max_threads = argc > 1 ? std::atoi(argv[1]) : omp_get_max_threads();
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  std::vector<int> thread_counts;
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  std::cout << fmt::format("{:>10}", "bins");
+  for (int threads : thread_counts) {
+    std::cout << fmt::format(" {:>9}", fmt::format("{}T (ms)", threads));
+  }
+  std::cout << "\n";
+
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(0.0, 1.0);
+  for (int bin_cnt = 64; bin_cnt <= 2048; bin_cnt *= 2) {
+    std::cout << fmt::format("{:>10}", fmt::format("{}x{}", bin_cnt, bin_cnt));
+    for (int threads : thread_counts) {
+      auto fft = std::make_unique<gpl::FFT>(
+          bin_cnt, bin_cnt, 100, 100, threads);
+      double total_ms = 0;
+      for (int i = 0; i < iterations; i++) {
+        for (int x = 0; x < bin_cnt; x++) {
+          for (int y = 0; y < bin_cnt; y++) {
+            fft->updateDensity(x, y, dist(rng));
+          }
+        }
+        auto start = std::chrono::steady_clock::now();
+        fft->doFFT();
+        std::chrono::duration<double, std::milli> elapsed
+            = std::chrono::steady_clock::now() - start;
+        total_ms += elapsed.count();
+      }
+      std::cout << fmt::format(" {:9.3f}", total_ms / iterations);
+    }
+    std::cout << "\n";
+  }
+
+  return 0;
+}
@@ -2,7 +2,9 @@
 
 #include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "spdlog/fmt/fmt.h"
@@ -146,4 +148,32 @@ TEST(FloatFFTTest, Basic)
   }
 }
 
+TEST(FloatFFTTest, ThreadsMatchSerial)
+{
+  const int x_max = 64;
+  const int y_max = 32;
+  std::unique_ptr<gpl::FFT> serial(new gpl::FFT(x_max, y_max, 10, 20));
+  std::unique_ptr<gpl::FFT> threaded(new gpl::FFT(x_max, y_max, 10, 20, 4));
+
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(0.0, 1.0);
+  for (int x = 0; x < x_max; x++) {
+    for (int y = 0; y < y_max; y++) {
+      float density = dist(rng);
+      serial->updateDensity(x, y, density);
+      threaded->updateDensity(x, y, density);
+    }
+  }
+
+  serial->doFFT();
+  threaded->doFFT();
+
+  for (int x = 0; x < x_max; x++) {
+    for (int y = 0; y < y_max; y++) {
+      EXPECT_EQ(serial->getElectroForce(x, y), threaded->getElectroForce(x, y));
+      EXPECT_EQ(serial->getElectroPhi(x, y), threaded->getElectroPhi(x, y));
+    }
+  }
+}
+
 }  // namespace
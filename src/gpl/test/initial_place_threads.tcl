@@ -0,0 +1,12 @@
+# Initial place with the X and Y solves in parallel sections must match
+# the serial solve in convergence01, also with the matrices updated in place.
+source helpers.tcl
+set_thread_count 2
+
+read_lef ./asap7/asap7_tech_1x_201209.lef
+read_lef ./asap7/asap7sc7p5t_28_R_1x_220121a.lef
+read_def convergence01.def
+
+global_placement -skip_nesterov_place -pad_left 2 -pad_right 2
+global_placement -skip_nesterov_place -pad_left 2 -pad_right 2 \
+  -initial_place_update_in_place
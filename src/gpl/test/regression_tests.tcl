@@ -27,6 +27,7 @@ record_tests {
   diverge01
   density01
   convergence01
+  initial_place_threads
   nograd01
   clust01
   #gpl_man_tcl_check
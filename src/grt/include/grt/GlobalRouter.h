@@ -178,6 +178,7 @@ class GlobalRouter : public ant::GlobalRouteSource
                            float reduction_percentage);
   void setVerbose(const bool v);
   void setOverflowIterations(int iterations);
+  void setNumThreads(int num_threads);
   void setCongestionReportIterStep(int congestion_report_iter_step);
   void setCongestionReportFile(const char* file_name);
   void setGridOrigin(int x, int y);
@@ -477,6 +478,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   int max_routing_layer_;
   int layer_for_guide_dimension_;
   int overflow_iterations_;
+  int num_threads_;
   int congestion_report_iter_step_;
   bool allow_congestion_;
   std::vector<int> vertical_capacities_;
@@ -95,6 +95,7 @@ GlobalRouter::GlobalRouter()
       max_routing_layer_(-1),
       layer_for_guide_dimension_(3),
       overflow_iterations_(50),
+      num_threads_(1),
       congestion_report_iter_step_(0),
       allow_congestion_(false),
       macro_extension_(0),
@@ -1727,6 +1728,11 @@ void GlobalRouter::setOverflowIterations(int iterations)
   overflow_iterations_ = iterations;
 }
 
+void GlobalRouter::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+}
+
 void GlobalRouter::setCongestionReportIterStep(int congestion_report_iter_step)
 {
   congestion_report_iter_step_ = congestion_report_iter_step;
@@ -1839,6 +1845,7 @@ void GlobalRouter::configFastRoute()
 {
   fastroute_->setVerbose(verbose_);
   fastroute_->setOverflowIterations(overflow_iterations_);
+  fastroute_->setNumThreads(num_threads_);
   fastroute_->setCongestionReportIterStep(congestion_report_iter_step_);
 
   if (congestion_file_name_ != nullptr) {
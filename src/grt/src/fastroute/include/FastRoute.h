@@ -40,6 +40,7 @@
 #include <boost/icl/interval.hpp>
 #include <boost/icl/interval_set.hpp>
 #include <boost/multi_array.hpp>
+#include <functional>
 #include <set>
 #include <unordered_map>
 #include <vector>
@@ -99,6 +100,35 @@ struct parent3D
   int x, y;
 };
 
+// Scratch buffers used to evaluate the cost of every Z-shaped pattern of a
+// tree edge. One instance is kept per thread so nets can be Z-routed
+// concurrently.
+struct ZRouteCosts
+{
+  void resize(int x_range, int y_range)
+  {
+    hvh.resize(x_range);
+    vhv.resize(y_range);
+    h.resize(y_range);
+    v.resize(x_range);
+    lr.resize(y_range);
+    tb.resize(x_range);
+    hvh_test.resize(x_range);
+    v_test.resize(x_range);
+    tb_test.resize(x_range);
+  }
+
+  std::vector<double> hvh;       // Horizontal first Z
+  std::vector<double> vhv;       // Vertical first Z
+  std::vector<double> h;         // Horizontal segment cost
+  std::vector<double> v;         // Vertical segment cost
+  std::vector<double> lr;        // Left and right boundary cost
+  std::vector<double> tb;        // Top and bottom boundary cost
+  std::vector<double> hvh_test;  // Horizontal first Z
+  std::vector<double> v_test;    // Vertical segment cost
+  std::vector<double> tb_test;   // Top and bottom boundary cost
+};
+
 class FastRouteCore
 {
  public:
@@ -195,6 +225,7 @@ class FastRouteCore
   float getCriticalNetsPercentage() { return critical_nets_percentage_; };
   void setMakeWireParasiticsBuilder(AbstractMakeWireParasitics* builder);
   void setOverflowIterations(int iterations);
+  void setNumThreads(int num_threads);
   void setCongestionReportIterStep(int congestion_report_iter_step);
   void setCongestionReportFile(const char* congestion_file_name);
   void setGridMax(int x_max, int y_max);
@@ -433,6 +464,10 @@ class FastRouteCore
                       multi_array<double, 2>& d2,
                       int threshold,
                       int enlarge);
+  std::vector<std::vector<int>> getNetBatches(int expand);
+  void routeNetBatches(int expand, const std::function<void(int)>& route_net);
+  void addUsedHEdge(int y, int x);
+  void addUsedVEdge(int y, int x);
 
   // ripup functions
   void ripupSegL(const Segment* seg);
@@ -559,6 +594,7 @@ class FastRouteCore
   std::vector<int> max_v_overflow_;
   odb::dbDatabase* db_;
   int overflow_iterations_;
+  int num_threads_;
   int congestion_report_iter_step_;
   std::string congestion_file_name_;
   std::vector<odb::dbTechLayerDir> layer_directions_;
@@ -596,15 +632,7 @@ class FastRouteCore
   std::vector<short> h_capacity_3D_;
   std::vector<short> last_col_v_capacity_3D_;
   std::vector<short> last_row_h_capacity_3D_;
-  std::vector<double> cost_hvh_;       // Horizontal first Z
-  std::vector<double> cost_vhv_;       // Vertical first Z
-  std::vector<double> cost_h_;         // Horizontal segment cost
-  std::vector<double> cost_v_;         // Vertical segment cost
-  std::vector<double> cost_lr_;        // Left and right boundary cost
-  std::vector<double> cost_tb_;        // Top and bottom boundary cost
-  std::vector<double> cost_hvh_test_;  // Vertical first Z
-  std::vector<double> cost_v_test_;    // Vertical segment cost
-  std::vector<double> cost_tb_test_;   // Top and bottom boundary cost
+  std::vector<ZRouteCosts> z_route_costs_;  // indexed by thread
   std::vector<double> h_cost_table_;
   std::vector<double> v_cost_table_;
   std::vector<int> xcor_;
@@ -654,6 +682,10 @@ class FastRouteCore
 
   std::set<std::pair<int, int>> h_used_ggrid_;
   std::set<std::pair<int, int>> v_used_ggrid_;
+  // Edges used by nets routed in parallel, indexed by thread and merged into
+  // h_used_ggrid_/v_used_ggrid_ after each batch.
+  std::vector<std::vector<std::pair<int, int>>> h_used_ggrid_threads_;
+  std::vector<std::vector<std::pair<int, int>>> v_used_ggrid_threads_;
   std::vector<int> net_ids_;
 
   // Maze 3D variables
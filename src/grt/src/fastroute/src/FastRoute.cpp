@@ -55,6 +55,7 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
     : max_degree_(0),
       db_(db),
       overflow_iterations_(0),
+      num_threads_(1),
       congestion_report_iter_step_(0),
       x_range_(0),
       y_range_(0),
@@ -140,15 +141,7 @@ void FastRouteCore::clear()
   v_capacity_3D_.clear();
   h_capacity_3D_.clear();
 
-  cost_hvh_.clear();
-  cost_vhv_.clear();
-  cost_h_.clear();
-  cost_v_.clear();
-  cost_lr_.clear();
-  cost_tb_.clear();
-  cost_hvh_test_.clear();
-  cost_v_test_.clear();
-  cost_tb_test_.clear();
+  z_route_costs_.clear();
 
   vertical_blocked_intervals_.clear();
   horizontal_blocked_intervals_.clear();
@@ -202,17 +195,6 @@ void FastRouteCore::setGridsAndLayers(int x, int y, int nLayers)
 
   in_region_.resize(boost::extents[y_range_][x_range_]);
 
-  cost_hvh_.resize(x_range_);  // Horizontal first Z
-  cost_vhv_.resize(y_range_);  // Vertical first Z
-  cost_h_.resize(y_range_);    // Horizontal segment cost
-  cost_v_.resize(x_range_);    // Vertical segment cost
-  cost_lr_.resize(y_range_);   // Left and right boundary cost
-  cost_tb_.resize(x_range_);   // Top and bottom boundary cost
-
-  cost_hvh_test_.resize(y_range_);  // Vertical first Z
-  cost_v_test_.resize(x_range_);    // Vertical segment cost
-  cost_tb_test_.resize(x_range_);   // Top and bottom boundary cost
-
   // maze3D variables
   directions_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
   corr_edge_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
@@ -944,6 +926,13 @@ NetRouteMap FastRouteCore::run()
   v_used_ggrid_.clear();
   h_used_ggrid_.clear();
 
+  z_route_costs_.resize(num_threads_);
+  for (ZRouteCosts& costs : z_route_costs_) {
+    costs.resize(x_range_, y_range_);
+  }
+  h_used_ggrid_threads_.resize(num_threads_);
+  v_used_ggrid_threads_.resize(num_threads_);
+
   int tUsage;
   int cost_step;
   int maxOverflow = 0;
@@ -1402,6 +1391,11 @@ void FastRouteCore::setOverflowIterations(int iterations)
   overflow_iterations_ = iterations;
 }
 
+void FastRouteCore::setNumThreads(int num_threads)
+{
+  num_threads_ = std::max(num_threads, 1);
+}
+
 void FastRouteCore::setCongestionReportIterStep(int congestion_report_iter_step)
 {
   congestion_report_iter_step_ = congestion_report_iter_step;
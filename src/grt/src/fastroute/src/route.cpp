@@ -30,12 +30,15 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <omp.h>
+
 #include <algorithm>
 #include <queue>
 
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -289,7 +292,7 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
       {
         for (int j = ymin; j < ymax; j++) {
           v_edges_[j][x1].est_usage += edgeCost;
-          v_used_ggrid_.insert(std::make_pair(j, x1));
+          addUsedVEdge(j, x1);
         }
         treeedge->route.xFirst = false;
         if (treenodes[n1].status % 2 == 0) {
@@ -302,7 +305,7 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
       {
         for (int j = x1; j < x2; j++) {
           h_edges_[y1][j].est_usage += edgeCost;
-          h_used_ggrid_.insert(std::make_pair(y1, j));
+          addUsedHEdge(y1, j);
         }
         treeedge->route.xFirst = true;
         if (treenodes[n2].status < 2) {
@@ -366,11 +369,11 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
           // two parts (x1, y1)-(x1, y2) and (x1, y2)-(x2, y2)
           for (int j = ymin; j < ymax; j++) {
             v_edges_[j][x1].est_usage += edgeCost;
-            v_used_ggrid_.insert(std::make_pair(j, x1));
+            addUsedVEdge(j, x1);
           }
           for (int j = x1; j < x2; j++) {
             h_edges_[y2][j].est_usage += edgeCost;
-            h_used_ggrid_.insert(std::make_pair(y2, j));
+            addUsedHEdge(y2, j);
           }
           treeedge->route.xFirst = false;
         }  // if costL1<costL2
@@ -385,11 +388,11 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
           // two parts (x1, y1)-(x2, y1) and (x2, y1)-(x2, y2)
           for (int j = x1; j < x2; j++) {
             h_edges_[y1][j].est_usage += edgeCost;
-            h_used_ggrid_.insert(std::make_pair(y1, j));
+            addUsedHEdge(y1, j);
           }
           for (int j = ymin; j < ymax; j++) {
             v_edges_[j][x2].est_usage += edgeCost;
-            v_used_ggrid_.insert(std::make_pair(j, x2));
+            addUsedVEdge(j, x2);
           }
           treeedge->route.xFirst = true;
         }
@@ -405,20 +408,17 @@ void FastRouteCore::newrouteL(int netID, RouteType ripuptype, bool viaGuided)
 // first
 void FastRouteCore::newrouteLAll(bool firstTime, bool viaGuided)
 {
-  if (firstTime) {
-    for (const int& netID : net_ids_) {
-      newrouteL(netID, RouteType::NoRoute, viaGuided);  // do L-routing
-    }
-  } else {
-    for (const int& netID : net_ids_) {
-      newrouteL(netID, RouteType::LRoute, viaGuided);
-    }
-  }
+  const RouteType ripuptype
+      = firstTime ? RouteType::NoRoute : RouteType::LRoute;
+  routeNetBatches(0, [this, ripuptype, viaGuided](const int netID) {
+    newrouteL(netID, ripuptype, viaGuided);
+  });
 }
 
 void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
 {
   const int edgeCost = nets_[netID]->getEdgeCost();
+  ZRouteCosts& costs = z_route_costs_[omp_get_thread_num()];
 
   // only route the non-degraded edges (len>0)
   if (sttrees_[netID].edges[edgeID].len <= 0) {
@@ -457,13 +457,13 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   // compute the cost for all Z routing
 
   for (int i = 0; i <= segWidth; i++) {
-    cost_hvh_[i] = 0;
-    cost_v_[i] = 0;
-    cost_tb_[i] = 0;
+    costs.hvh[i] = 0;
+    costs.v[i] = 0;
+    costs.tb[i] = 0;
 
-    cost_hvh_test_[i] = 0;
-    cost_v_test_[i] = 0;
-    cost_tb_test_[i] = 0;
+    costs.hvh_test[i] = 0;
+    costs.v_test[i] = 0;
+    costs.tb_test[i] = 0;
   }
 
   // compute the cost for all H-segs and V-segs and partial boundary seg
@@ -472,10 +472,10 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
     for (int j = ymin; j < ymax; j++) {
       const double tmp = v_edges_[j][i].est_usage_red() - v_capacity_lb_;
       if (tmp > 0) {
-        cost_v_[i - x1] += tmp;
-        cost_v_test_[i - x1] += HCOST;
+        costs.v[i - x1] += tmp;
+        costs.v_test[i - x1] += HCOST;
       } else {
-        cost_v_test_[i - x1] += tmp;
+        costs.v_test[i - x1] += tmp;
       }
     }
   }
@@ -483,29 +483,29 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   for (int j = x1; j < x2; j++) {
     const double tmp = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
     if (tmp > 0) {
-      cost_tb_[0] += tmp;
-      cost_tb_test_[0] += HCOST;
+      costs.tb[0] += tmp;
+      costs.tb_test[0] += HCOST;
     } else {
-      cost_tb_test_[0] += tmp;
+      costs.tb_test[0] += tmp;
     }
   }
   for (int i = 1; i <= segWidth; i++) {
-    cost_tb_[i] = cost_tb_[i - 1];
+    costs.tb[i] = costs.tb[i - 1];
     const double tmp1
         = h_edges_[y1][x1 + i - 1].est_usage_red() - h_capacity_lb_;
     if (tmp1 > 0) {
-      cost_tb_[i] += tmp1;
-      cost_tb_test_[i] += HCOST;
+      costs.tb[i] += tmp1;
+      costs.tb_test[i] += HCOST;
     } else {
-      cost_tb_test_[i] += tmp1;
+      costs.tb_test[i] += tmp1;
     }
     const double tmp2
         = h_edges_[y2][x1 + i - 1].est_usage_red() - h_capacity_lb_;
     if (tmp2 > 0) {
-      cost_tb_[i] -= tmp2;
-      cost_tb_test_[i] -= HCOST;
+      costs.tb[i] -= tmp2;
+      costs.tb_test[i] -= HCOST;
     } else {
-      cost_tb_test_[i] -= tmp2;
+      costs.tb_test[i] -= tmp2;
     }
   }
   // compute cost for all Z routing
@@ -513,15 +513,15 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
   double btTEST = BIG_INT;
   int bestZ = 0;
   for (int i = 0; i <= segWidth; i++) {
-    cost_hvh_[i] = cost_v_[i] + cost_tb_[i];
-    cost_hvh_test_[i] = cost_v_test_[i] + cost_tb_test_[i];
-    if (cost_hvh_[i] < bestcost) {
-      bestcost = cost_hvh_[i];
-      btTEST = cost_hvh_test_[i];
+    costs.hvh[i] = costs.v[i] + costs.tb[i];
+    costs.hvh_test[i] = costs.v_test[i] + costs.tb_test[i];
+    if (costs.hvh[i] < bestcost) {
+      bestcost = costs.hvh[i];
+      btTEST = costs.hvh_test[i];
       bestZ = i + x1;
-    } else if (cost_hvh_[i] == bestcost) {
-      if (cost_hvh_test_[i] < btTEST) {
-        btTEST = cost_hvh_test_[i];
+    } else if (costs.hvh[i] == bestcost) {
+      if (costs.hvh_test[i] < btTEST) {
+        btTEST = costs.hvh_test[i];
         bestZ = i + x1;
       }
     }
@@ -529,15 +529,15 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
 
   for (int i = x1; i < bestZ; i++) {
     h_edges_[y1][i].est_usage += edgeCost;
-    h_used_ggrid_.insert(std::make_pair(y1, i));
+    addUsedHEdge(y1, i);
   }
   for (int i = bestZ; i < x2; i++) {
     h_edges_[y2][i].est_usage += edgeCost;
-    h_used_ggrid_.insert(std::make_pair(y2, i));
+    addUsedHEdge(y2, i);
   }
   for (int i = ymin; i < ymax; i++) {
     v_edges_[i][bestZ].est_usage += edgeCost;
-    v_used_ggrid_.insert(std::make_pair(i, bestZ));
+    addUsedVEdge(i, bestZ);
   }
   treeedge->route.HVH = true;
   treeedge->route.Zpoint = bestZ;
@@ -547,6 +547,7 @@ void FastRouteCore::newrouteZ_edge(int netID, int edgeID)
 void FastRouteCore::newrouteZ(int netID, int threshold)
 {
   const int edgeCost = nets_[netID]->getEdgeCost();
+  ZRouteCosts& costs = z_route_costs_[omp_get_thread_num()];
 
   const int num_terminals = sttrees_[netID].num_terminals;
   const int num_edges = sttrees_[netID].num_edges();
@@ -598,52 +599,52 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
 
         if (status1 == 0 || status1 == 3) {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] = 0;
-            cost_hvh_test_[i] = 0;
+            costs.hvh[i] = 0;
+            costs.hvh_test[i] = 0;
           }
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] = 0;
+            costs.vhv[i] = 0;
           }
         } else if (status1 == 2) {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] = 0;
-            cost_hvh_test_[i] = 0;
+            costs.hvh[i] = 0;
+            costs.hvh_test[i] = 0;
           }
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] = via_cost_;
+            costs.vhv[i] = via_cost_;
           }
         } else {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] = via_cost_;
-            cost_hvh_test_[i] = via_cost_;
+            costs.hvh[i] = via_cost_;
+            costs.hvh_test[i] = via_cost_;
           }
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] = 0;
+            costs.vhv[i] = 0;
           }
         }
 
         if (status2 == 2) {
           for (int i = 0; i < segHeight; i++) {
-            cost_vhv_[i] += via_cost_;
+            costs.vhv[i] += via_cost_;
           }
 
         } else if (status2 == 1) {
           for (int i = 0; i < segWidth; i++) {
-            cost_hvh_[i] += via_cost_;
-            cost_hvh_test_[i] += via_cost_;
+            costs.hvh[i] += via_cost_;
+            costs.hvh_test[i] += via_cost_;
           }
         }
 
         for (int i = 0; i < segWidth; i++) {
-          cost_v_[i] = 0;
-          cost_tb_[i] = 0;
+          costs.v[i] = 0;
+          costs.tb[i] = 0;
 
-          cost_v_test_[i] = 0;
-          cost_tb_test_[i] = 0;
+          costs.v_test[i] = 0;
+          costs.tb_test[i] = 0;
         }
         for (int i = 0; i < segHeight; i++) {
-          cost_h_[i] = 0;
-          cost_lr_[i] = 0;
+          costs.h[i] = 0;
+          costs.lr[i] = 0;
         }
 
         // compute the cost for all H-segs and V-segs and partial boundary seg
@@ -652,10 +653,10 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           for (int j = ymin; j < ymax; j++) {
             const double tmp = v_edges_[j][i].est_usage_red() - v_capacity_lb_;
             if (tmp > 0) {
-              cost_v_[i - x1] += tmp;
-              cost_v_test_[i - x1] += HCOST;
+              costs.v[i - x1] += tmp;
+              costs.v_test[i - x1] += HCOST;
             } else {
-              cost_v_test_[i - x1] += tmp;
+              costs.v_test[i - x1] += tmp;
             }
           }
         }
@@ -663,29 +664,29 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         for (int j = x1; j < x2; j++) {
           const double tmp = h_edges_[y2][j].est_usage_red() - h_capacity_lb_;
           if (tmp > 0) {
-            cost_tb_[0] += tmp;
-            cost_tb_test_[0] += HCOST;
+            costs.tb[0] += tmp;
+            costs.tb_test[0] += HCOST;
           } else {
-            cost_tb_test_[0] += tmp;
+            costs.tb_test[0] += tmp;
           }
         }
         for (int i = 1; i < segWidth; i++) {
-          cost_tb_[i] = cost_tb_[i - 1];
+          costs.tb[i] = costs.tb[i - 1];
           const double tmp1
               = h_edges_[y1][x1 + i - 1].est_usage_red() - h_capacity_lb_;
           if (tmp1 > 0) {
-            cost_tb_[i] += tmp1;
-            cost_tb_test_[0] += HCOST;
+            costs.tb[i] += tmp1;
+            costs.tb_test[0] += HCOST;
           } else {
-            cost_tb_test_[0] += tmp1;
+            costs.tb_test[0] += tmp1;
           }
           const double tmp2
               = h_edges_[y2][x1 + i - 1].est_usage_red() - h_capacity_lb_;
           if (tmp2 > 0) {
-            cost_tb_[i] -= tmp2;
-            cost_tb_test_[0] -= HCOST;
+            costs.tb[i] -= tmp2;
+            costs.tb_test[0] -= HCOST;
           } else {
-            cost_tb_test_[0] -= tmp2;
+            costs.tb_test[0] -= tmp2;
           }
         }
         // cost for H-segs
@@ -693,7 +694,7 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           for (int j = x1; j < x2; j++) {
             const double tmp = h_edges_[i][j].est_usage_red() - h_capacity_lb_;
             if (tmp > 0)
-              cost_h_[i - ymin] += tmp;
+              costs.h[i - ymin] += tmp;
           }
         }
         // cost for Left&Right boundary segs (form Z with H-seg)
@@ -701,35 +702,35 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           for (int j = y1; j < y2; j++) {
             const double tmp = v_edges_[j][x2].est_usage_red() - v_capacity_lb_;
             if (tmp > 0)
-              cost_lr_[0] += tmp;
+              costs.lr[0] += tmp;
           }
           for (int i = 1; i < segHeight; i++) {
-            cost_lr_[i] = cost_lr_[i - 1];
+            costs.lr[i] = costs.lr[i - 1];
             const double tmp1
                 = v_edges_[y1 + i - 1][x1].est_usage_red() - v_capacity_lb_;
             if (tmp1 > 0)
-              cost_lr_[i] += tmp1;
+              costs.lr[i] += tmp1;
             const double tmp2
                 = v_edges_[y1 + i - 1][x2].est_usage_red() - v_capacity_lb_;
             if (tmp2 > 0)
-              cost_lr_[i] -= tmp2;
+              costs.lr[i] -= tmp2;
           }
         } else {
           for (int j = y2; j < y1; j++) {
             const double tmp = v_edges_[j][x1].est_usage - v_capacity_lb_;
             if (tmp > 0)
-              cost_lr_[0] += tmp;
+              costs.lr[0] += tmp;
           }
           for (int i = 1; i < segHeight; i++) {
-            cost_lr_[i] = cost_lr_[i - 1];
+            costs.lr[i] = costs.lr[i - 1];
             const double tmp1
                 = v_edges_[y2 + i - 1][x2].est_usage_red() - v_capacity_lb_;
             if (tmp1 > 0)
-              cost_lr_[i] += tmp1;
+              costs.lr[i] += tmp1;
             const double tmp2
                 = v_edges_[y2 + i - 1][x1].est_usage_red() - v_capacity_lb_;
             if (tmp2 > 0)
-              cost_lr_[i] -= tmp2;
+              costs.lr[i] -= tmp2;
           }
         }
 
@@ -739,22 +740,22 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
         double btTEST = BIG_INT;
         int bestZ = 0;
         for (int i = 0; i < segWidth; i++) {
-          cost_hvh_[i] += cost_v_[i] + cost_tb_[i];
-          if (cost_hvh_[i] < bestcost) {
-            bestcost = cost_hvh_[i];
-            btTEST = cost_hvh_test_[i];
+          costs.hvh[i] += costs.v[i] + costs.tb[i];
+          if (costs.hvh[i] < bestcost) {
+            bestcost = costs.hvh[i];
+            btTEST = costs.hvh_test[i];
             bestZ = i + x1;
-          } else if (cost_hvh_[i] == bestcost) {
-            if (cost_hvh_test_[i] < btTEST) {
-              btTEST = cost_hvh_test_[i];
+          } else if (costs.hvh[i] == bestcost) {
+            if (costs.hvh_test[i] < btTEST) {
+              btTEST = costs.hvh_test[i];
               bestZ = i + x1;
             }
           }
         }
         for (int i = 0; i < segHeight; i++) {
-          cost_vhv_[i] += cost_h_[i] + cost_lr_[i];
-          if (cost_vhv_[i] < bestcost) {
-            bestcost = cost_vhv_[i];
+          costs.vhv[i] += costs.h[i] + costs.lr[i];
+          if (costs.vhv[i] < bestcost) {
+            bestcost = costs.vhv[i];
             bestZ = i + ymin;
             HVH = false;
           }
@@ -773,15 +774,15 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
 
           for (int i = x1; i < bestZ; i++) {
             h_edges_[y1][i].est_usage += edgeCost;
-            h_used_ggrid_.insert(std::make_pair(y1, i));
+            addUsedHEdge(y1, i);
           }
           for (int i = bestZ; i < x2; i++) {
             h_edges_[y2][i].est_usage += edgeCost;
-            h_used_ggrid_.insert(std::make_pair(y2, i));
+            addUsedHEdge(y2, i);
           }
           for (int i = ymin; i < ymax; i++) {
             v_edges_[i][bestZ].est_usage += edgeCost;
-            v_used_ggrid_.insert(std::make_pair(i, bestZ));
+            addUsedVEdge(i, bestZ);
           }
           treeedge->route.HVH = HVH;
           treeedge->route.Zpoint = bestZ;
@@ -798,30 +799,30 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
           if (y1Smaller) {
             for (int i = y1; i < bestZ; i++) {
               v_edges_[i][x1].est_usage += edgeCost;
-              v_used_ggrid_.insert(std::make_pair(i, x1));
+              addUsedVEdge(i, x1);
             }
             for (int i = bestZ; i < y2; i++) {
               v_edges_[i][x2].est_usage += edgeCost;
-              v_used_ggrid_.insert(std::make_pair(i, x2));
+              addUsedVEdge(i, x2);
             }
             for (int i = x1; i < x2; i++) {
               h_edges_[bestZ][i].est_usage += edgeCost;
-              h_used_ggrid_.insert(std::make_pair(bestZ, i));
+              addUsedHEdge(bestZ, i);
             }
             treeedge->route.HVH = HVH;
             treeedge->route.Zpoint = bestZ;
           } else {
             for (int i = y2; i < bestZ; i++) {
               v_edges_[i][x2].est_usage += edgeCost;
-              v_used_ggrid_.insert(std::make_pair(i, x2));
+              addUsedVEdge(i, x2);
             }
             for (int i = bestZ; i < y1; i++) {
               v_edges_[i][x1].est_usage += edgeCost;
-              v_used_ggrid_.insert(std::make_pair(i, x1));
+              addUsedVEdge(i, x1);
             }
             for (int i = x1; i < x2; i++) {
               h_edges_[bestZ][i].est_usage += edgeCost;
-              h_used_ggrid_.insert(std::make_pair(bestZ, i));
+              addUsedHEdge(bestZ, i);
             }
             treeedge->route.HVH = HVH;
             treeedge->route.Zpoint = bestZ;
@@ -842,9 +843,9 @@ void FastRouteCore::newrouteZ(int netID, int threshold)
 // first
 void FastRouteCore::newrouteZAll(int threshold)
 {
-  for (const int& netID : net_ids_) {
-    newrouteZ(netID, threshold);  // ripup previous route and do Z-routing
-  }
+  // ripup previous route and do Z-routing
+  routeNetBatches(
+      0, [this, threshold](const int netID) { newrouteZ(netID, threshold); });
 }
 
 void FastRouteCore::spiralRoute(int netID, int edgeID)
@@ -1308,7 +1309,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = y1;
         h_edges_[y1][i].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(y1, i));
+        addUsedHEdge(y1, i);
         cnt++;
       }
     } else {
@@ -1316,7 +1317,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = y1;
         h_edges_[y1][i - 1].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(y1, i - 1));
+        addUsedHEdge(y1, i - 1);
         cnt++;
       }
     }
@@ -1326,7 +1327,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[i][bestp1x].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i, bestp1x));
+        addUsedVEdge(i, bestp1x);
       }
     } else {
       for (int i = y1; i > bestp1y; i--) {
@@ -1334,7 +1335,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[(i - 1)][bestp1x].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i - 1, bestp1x));
+        addUsedVEdge(i - 1, bestp1x);
       }
     }
   } else {
@@ -1344,7 +1345,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[i][x1].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i, x1));
+        addUsedVEdge(i, x1);
       }
     } else {
       for (int i = y1; i > bestp1y; i--) {
@@ -1352,7 +1353,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[(i - 1)][x1].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i - 1, x1));
+        addUsedVEdge(i - 1, x1);
       }
     }
     if (bestp1x > x1) {
@@ -1360,7 +1361,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = bestp1y;
         h_edges_[bestp1y][i].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(bestp1y, i));
+        addUsedHEdge(bestp1y, i);
         cnt++;
       }
     } else {
@@ -1368,7 +1369,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = bestp1y;
         h_edges_[bestp1y][(i - 1)].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(bestp1y, i - 1));
+        addUsedHEdge(bestp1y, i - 1);
         cnt++;
       }
     }
@@ -1380,7 +1381,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = bestp1y;
         h_edges_[bestp1y][i].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(bestp1y, i));
+        addUsedHEdge(bestp1y, i);
         cnt++;
       }
     } else {
@@ -1388,7 +1389,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = bestp1y;
         h_edges_[bestp1y][i - 1].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(bestp1y, i - 1));
+        addUsedHEdge(bestp1y, i - 1);
         cnt++;
       }
     }
@@ -1399,7 +1400,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[i][x2].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i, x2));
+        addUsedVEdge(i, x2);
       }
     } else {
       for (int i = bestp1y; i > y2; i--) {
@@ -1407,7 +1408,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[(i - 1)][x2].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i - 1, x2));
+        addUsedVEdge(i - 1, x2);
       }
     }
   } else {
@@ -1417,7 +1418,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[i][bestp1x].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i, bestp1x));
+        addUsedVEdge(i, bestp1x);
       }
     } else {
       for (int i = bestp1y; i > y2; i--) {
@@ -1425,7 +1426,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsY[cnt] = i;
         cnt++;
         v_edges_[(i - 1)][bestp1x].usage += edgeCost;
-        v_used_ggrid_.insert(std::make_pair(i - 1, bestp1x));
+        addUsedVEdge(i - 1, bestp1x);
       }
     }
     if (x2 > bestp1x) {
@@ -1433,7 +1434,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = y2;
         h_edges_[y2][i].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(y2, i));
+        addUsedHEdge(y2, i);
         cnt++;
       }
     } else {
@@ -1441,7 +1442,7 @@ void FastRouteCore::routeMonotonic(int netID,
         gridsX[cnt] = i;
         gridsY[cnt] = y2;
         h_edges_[y2][(i - 1)].usage += edgeCost;
-        h_used_ggrid_.insert(std::make_pair(y2, i - 1));
+        addUsedHEdge(y2, i - 1);
         cnt++;
       }
     }
@@ -1477,23 +1478,159 @@ void FastRouteCore::routeMonotonicAll(int threshold,
         = costheight_ / (exp((double) (h_capacity_ - i) * logis_cof) + 1) + 1;
   }
 
-  multi_array<double, 2> d1(boost::extents[y_range_][x_range_]);
-  multi_array<double, 2> d2(boost::extents[y_range_][x_range_]);
+  // One pair of cost grids per thread
+  std::vector<multi_array<double, 2>> d1(num_threads_);
+  std::vector<multi_array<double, 2>> d2(num_threads_);
+  for (int t = 0; t < num_threads_; t++) {
+    d1[t].resize(boost::extents[y_grid_][x_grid_]);
+    d2[t].resize(boost::extents[y_grid_][x_grid_]);
+  }
 
-  for (const int& netID : net_ids_) {
+  routeNetBatches(expand, [&](const int netID) {
+    const int thread = omp_get_thread_num();
     const int numEdges = sttrees_[netID].num_edges();
     for (int edgeID = 0; edgeID < numEdges; edgeID++) {
       routeMonotonic(netID,
                      edgeID,
-                     d1,
-                     d2,
+                     d1[thread],
+                     d2[thread],
                      threshold,
                      expand);  // ripup previous route and do Monotonic routing
     }
-  }
+  });
   h_cost_table_.clear();
 }
 
+// Groups the nets into batches that can be routed concurrently. Pattern
+// routing a net only reads and writes the edges inside the bounding box of
+// its tree (plus expand, for monotonic routing), so two nets whose boxes do
+// not share a tile can be routed in any order. Each net is placed one batch
+// after the last earlier net that shares a tile with it, which keeps the
+// serial order between dependent nets. Routing the batches one after the
+// other therefore gives the same result as routing net_ids_ serially,
+// regardless of the number of threads.
+std::vector<std::vector<int>> FastRouteCore::getNetBatches(const int expand)
+{
+  // Coarse tiles bound the cost of the dependency computation on large grids
+  // at the price of some false dependencies.
+  const int max_tiles_per_side = 512;
+  const int tile_size = std::max(x_grid_, y_grid_) / max_tiles_per_side + 1;
+  const int x_tiles = (x_grid_ + tile_size - 1) / tile_size;
+  const int y_tiles = (y_grid_ + tile_size - 1) / tile_size;
+
+  // Batch of the last net that touched each tile
+  std::vector<int> last_batch(static_cast<size_t>(x_tiles) * y_tiles, -1);
+  std::vector<std::vector<int>> batches;
+
+  for (const int& netID : net_ids_) {
+    const auto& treenodes = sttrees_[netID].nodes;
+    if (treenodes.empty()) {
+      if (batches.empty()) {
+        batches.resize(1);
+      }
+      batches[0].push_back(netID);
+      continue;
+    }
+
+    int xmin = x_grid_;
+    int ymin = y_grid_;
+    int xmax = 0;
+    int ymax = 0;
+    for (const TreeNode& node : treenodes) {
+      xmin = std::min(xmin, static_cast<int>(node.x));
+      ymin = std::min(ymin, static_cast<int>(node.y));
+      xmax = std::max(xmax, static_cast<int>(node.x));
+      ymax = std::max(ymax, static_cast<int>(node.y));
+    }
+    const int tx_min = std::max(xmin - expand, 0) / tile_size;
+    const int ty_min = std::max(ymin - expand, 0) / tile_size;
+    const int tx_max = std::min(xmax + expand, x_grid_ - 1) / tile_size;
+    const int ty_max = std::min(ymax + expand, y_grid_ - 1) / tile_size;
+
+    int batch = 0;
+    for (int ty = ty_min; ty <= ty_max; ty++) {
+      for (int tx = tx_min; tx <= tx_max; tx++) {
+        batch = std::max(batch, last_batch[ty * x_tiles + tx] + 1);
+      }
+    }
+    for (int ty = ty_min; ty <= ty_max; ty++) {
+      for (int tx = tx_min; tx <= tx_max; tx++) {
+        last_batch[ty * x_tiles + tx] = batch;
+      }
+    }
+
+    if (batch >= static_cast<int>(batches.size())) {
+      batches.resize(batch + 1);
+    }
+    batches[batch].push_back(netID);
+  }
+
+  return batches;
+}
+
+void FastRouteCore::routeNetBatches(
+    const int expand,
+    const std::function<void(int)>& route_net)
+{
+  if (num_threads_ == 1) {
+    for (const int& netID : net_ids_) {
+      route_net(netID);
+    }
+    return;
+  }
+
+  const std::vector<std::vector<int>> batches = getNetBatches(expand);
+  debugPrint(logger_,
+             GRT,
+             "patternRouting",
+             1,
+             "Routing {} nets in {} batches with {} threads.",
+             net_ids_.size(),
+             batches.size(),
+             num_threads_);
+
+  for (const std::vector<int>& batch : batches) {
+    const int batch_size = batch.size();
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+    for (int i = 0; i < batch_size; i++) {
+      try {
+        route_net(batch[i]);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+  }
+
+  for (int t = 0; t < num_threads_; t++) {
+    h_used_ggrid_.insert(h_used_ggrid_threads_[t].begin(),
+                         h_used_ggrid_threads_[t].end());
+    v_used_ggrid_.insert(v_used_ggrid_threads_[t].begin(),
+                         v_used_ggrid_threads_[t].end());
+    h_used_ggrid_threads_[t].clear();
+    v_used_ggrid_threads_[t].clear();
+  }
+}
+
+void FastRouteCore::addUsedHEdge(const int y, const int x)
+{
+  if (omp_in_parallel()) {
+    h_used_ggrid_threads_[omp_get_thread_num()].emplace_back(y, x);
+  } else {
+    h_used_ggrid_.insert(std::make_pair(y, x));
+  }
+}
+
+void FastRouteCore::addUsedVEdge(const int y, const int x)
+{
+  if (omp_in_parallel()) {
+    v_used_ggrid_threads_[omp_get_thread_num()].emplace_back(y, x);
+  } else {
+    v_used_ggrid_.insert(std::make_pair(y, x));
+  }
+}
+
 void FastRouteCore::newrouteLInMaze(int netID)
 {
   const int num_edges = sttrees_[netID].num_edges();
@@ -0,0 +1,14 @@
+# gcd routed on multiple threads must match the single-threaded guides
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set_thread_count 2
+
+set guide_file [make_result_file gcd_threads.guide]
+
+global_route -verbose
+
+write_guides $guide_file
+
+diff_files gcd.guideok $guide_file
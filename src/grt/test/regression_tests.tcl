@@ -18,6 +18,7 @@ record_tests {
   est_rc4
   gcd
   gcd_flute
+  gcd_threads
   inst_pin_out_of_die
   invalid_routing_layer
   invalid_pin_placement
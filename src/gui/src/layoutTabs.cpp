@@ -199,6 +199,13 @@ void LayoutTabs::fullRepaint()
   }
 }
 
+void LayoutTabs::partialRepaint()
+{
+  for (auto viewer : viewers_) {
+    viewer->partialRepaint();
+  }
+}
+
 void LayoutTabs::startRulerBuild()
 {
   if (current_viewer_) {
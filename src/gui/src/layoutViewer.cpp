@@ -168,7 +168,7 @@ LayoutViewer::LayoutViewer(
           this,
           &LayoutViewer::handleLoadingIndication);
 
-  connect(&search_, &Search::modified, this, &LayoutViewer::fullRepaint);
+  connect(&search_, &Search::modified, this, &LayoutViewer::designModified);
 
   connect(&search_, &Search::newBlock, this, &LayoutViewer::setBlock);
 }
@@ -605,7 +605,7 @@ std::pair<LayoutViewer::Edge, bool> LayoutViewer::searchNearestEdge(
   // Cache the search results as we will iterate over the instances
   // for each layer.
   std::vector<dbInst*> insts;
-  for (auto* inst : inst_range) {
+  for (const auto& [box, inst] : inst_range) {
     if (options_->isInstanceVisible(inst)) {
       if (inst_internals_visible) {
         // only add inst if it can be used for pin or obs search
@@ -944,7 +944,7 @@ void LayoutViewer::selectAt(odb::Rect region, std::vector<Selected>& selections)
                                    region.yMax(),
                                    instanceSizeLimit());
 
-  for (auto* inst : insts) {
+  for (const auto& [box, inst] : insts) {
     if (options_->isInstanceVisible(inst)) {
       if (options_->isInstanceSelectable(inst)) {
         selections.push_back(gui_->makeSelected(inst));
@@ -1410,6 +1410,7 @@ void LayoutViewer::boxesByLayer(dbMaster* master, LayerBoxes& boxes)
 const LayoutViewer::Boxes* LayoutViewer::boxesByLayer(dbMaster* master,
                                                       dbTechLayer* layer)
 {
+  std::lock_guard<std::mutex> lock(cell_boxes_mutex_);
   auto it = cell_boxes_.find(master);
   if (it == cell_boxes_.end()) {
     LayerBoxes& boxes = cell_boxes_[master];
@@ -1888,10 +1889,27 @@ void LayoutViewer::paintEvent(QPaintEvent* event)
 }
 
 void LayoutViewer::fullRepaint()
+{
+  viewer_thread_.invalidateTiles();
+  partialRepaint();
+}
+
+void LayoutViewer::designModified()
+{
+  std::vector<odb::Rect> regions;
+  if (search_.takeModifiedRegions(regions)) {
+    viewer_thread_.invalidateTiles(regions);
+  } else {
+    viewer_thread_.invalidateTiles();
+  }
+  partialRepaint();
+}
+
+void LayoutViewer::partialRepaint()
 {
   if (command_executing_ && !paused_) {
     QTimer::singleShot(
-        5 /*ms*/, this, &LayoutViewer::fullRepaint);  // retry later
+        5 /*ms*/, this, &LayoutViewer::partialRepaint);  // retry later
     return;
   }
 
@@ -2010,7 +2028,7 @@ void LayoutViewer::setScroller(LayoutScroll* scroller)
   connect(scroller_,
           &LayoutScroll::centerChanged,
           this,
-          &LayoutViewer::fullRepaint);
+          &LayoutViewer::partialRepaint);
 }
 
 void LayoutViewer::viewportUpdated()
@@ -2457,7 +2475,10 @@ void LayoutViewer::executionPaused()
 
 void LayoutViewer::resetCache()
 {
-  cell_boxes_.clear();
+  {
+    std::lock_guard<std::mutex> lock(cell_boxes_mutex_);
+    cell_boxes_.clear();
+  }
   fullRepaint();
 }
 
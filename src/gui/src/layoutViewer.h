@@ -49,6 +49,7 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "gui/gui.h"
@@ -245,6 +246,12 @@ class LayoutViewer : public QWidget
 
   // signals that the cache should be flushed and a full repaint should occur.
   void fullRepaint();
+  // repaint reusing the cached layout tiles, for when only the view
+  // position, selection, highlights or rulers changed.
+  void partialRepaint();
+  // repaint after a design edit, dropping only the cached tiles that
+  // overlap the edited areas.
+  void designModified();
 
   odb::Point getVisibleCenter();
 
@@ -387,6 +394,8 @@ class LayoutViewer : public QWidget
   int max_depth_;
   Search search_;
   CellBoxes cell_boxes_;
+  // The render thread populates the cache from several threads
+  std::mutex cell_boxes_mutex_;
   QRect rubber_band_;  // screen coordinates
   QPoint mouse_press_pos_;
   QPoint mouse_move_pos_;
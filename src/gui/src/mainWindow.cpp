@@ -192,11 +192,17 @@ MainWindow::MainWindow(QWidget* parent)
         addRuler(x0, y0, x1, y1, "", "", default_ruler_style_->isChecked());
       });
 
+  // These are drawn on top of the layout so the cached tiles remain valid
+  connect(this,
+          &MainWindow::selectionChanged,
+          viewers_,
+          &LayoutTabs::partialRepaint);
+  connect(this,
+          &MainWindow::highlightChanged,
+          viewers_,
+          &LayoutTabs::partialRepaint);
   connect(
-      this, &MainWindow::selectionChanged, viewers_, &LayoutTabs::fullRepaint);
-  connect(
-      this, &MainWindow::highlightChanged, viewers_, &LayoutTabs::fullRepaint);
-  connect(this, &MainWindow::rulersChanged, viewers_, &LayoutTabs::fullRepaint);
+      this, &MainWindow::rulersChanged, viewers_, &LayoutTabs::partialRepaint);
 
   connect(controls_, &DisplayControls::selected, [=](const Selected& selected) {
     setSelected(selected);
@@ -221,7 +227,7 @@ MainWindow::MainWindow(QWidget* parent)
   connect(inspector_,
           &Inspector::selectedItemChanged,
           viewers_,
-          &LayoutTabs::fullRepaint);
+          &LayoutTabs::partialRepaint);
   connect(inspector_,
           &Inspector::selectedItemChanged,
           this,
@@ -33,11 +33,15 @@
 #include "renderThread.h"
 
 #include <QPainterPath>
+#include <algorithm>
+#include <cmath>
 
 #include "layoutViewer.h"
 #include "odb/dbShape.h"
 #include "odb/dbTransform.h"
+#include "ord/OpenRoad.hh"
 #include "painter.h"
+#include "utl/exception.h"
 #include "utl/timer.h"
 
 namespace gui {
@@ -124,13 +128,14 @@ void RenderThread::run()
                  QImage::Format_ARGB32_Premultiplied);
     // drawing can be interrupted by setting restart_
     try {
-      draw(image,
-           draw_bounds,
-           selected,
-           highlighted,
-           rulers,
-           1.0,
-           Qt::transparent);
+      drawImage(image,
+                draw_bounds,
+                selected,
+                highlighted,
+                rulers,
+                1.0,
+                Qt::transparent,
+                true);
     } catch (const std::exception& e) {
       logger_->warn(
           GUI, 102, "An exception occurred during rendering: {}", e.what());
@@ -185,6 +190,25 @@ void RenderThread::draw(QImage& image,
                         const Rulers& rulers,
                         qreal render_ratio,
                         const QColor& background)
+{
+  drawImage(image,
+            draw_bounds,
+            selected,
+            highlighted,
+            rulers,
+            render_ratio,
+            background,
+            false);
+}
+
+void RenderThread::drawImage(QImage& image,
+                             const QRect& draw_bounds,
+                             const SelectionSet& selected,
+                             const HighlightSet& highlighted,
+                             const Rulers& rulers,
+                             qreal render_ratio,
+                             const QColor& background,
+                             bool use_tiles)
 {
   if (image.isNull()) {
     return;
@@ -221,7 +245,11 @@ void RenderThread::draw(QImage& image,
     image.fill(background);
   }
 
-  drawBlock(&painter, viewer_->block_, dbu_bounds, 0);
+  drawBlock(&painter,
+            viewer_->block_,
+            dbu_bounds,
+            0,
+            use_tiles ? &draw_bounds : nullptr);
 
   // draw selected and over top level and fast painting events
   drawSelected(gui_painter, selected);
@@ -504,8 +532,7 @@ void RenderThread::drawInstanceOutlines(QPainter* painter,
 void RenderThread::drawInstanceShapes(dbTechLayer* layer,
                                       QPainter* painter,
                                       const std::vector<odb::dbInst*>& insts,
-                                      const Rect& bounds,
-                                      GuiPainter& gui_painter)
+                                      const Rect& bounds)
 {
   const bool show_blockages = viewer_->options_->areInstanceBlockagesVisible();
   const bool show_pins = viewer_->options_->areInstancePinsVisible();
@@ -548,13 +575,13 @@ void RenderThread::drawInstanceShapes(dbTechLayer* layer,
                                                      instance_limit);
       child_insts.clear();
       child_insts.reserve(10000);
-      for (auto* inst : inst_range) {
+      for (const auto& [box, inst] : inst_range) {
         if (viewer_->options_->isInstanceVisible(inst)) {
           child_insts.push_back(inst);
         }
       }
 
-      drawLayer(painter, child, layer, child_insts, bbox, gui_painter);
+      drawLayerShapes(painter, child, layer, child_insts, bbox);
       continue;
     }
 
@@ -877,6 +904,16 @@ void RenderThread::drawViaShapes(QPainter* painter,
   }
 }
 
+int RenderThread::cutMaximumSize(dbTechLayer* cut_layer) const
+{
+  // Not using operator[] as this is called from several threads.
+  const auto it = viewer_->cut_maximum_size_.find(cut_layer);
+  if (it == viewer_->cut_maximum_size_.end()) {
+    return 0;
+  }
+  return it->second;
+}
+
 void RenderThread::drawLayer(QPainter* painter,
                              odb::dbBlock* block,
                              dbTechLayer* layer,
@@ -889,17 +926,40 @@ void RenderThread::drawLayer(QPainter* painter,
   }
   utl::Timer layer_timer;
 
+  drawLayerShapes(painter, block, layer, insts, bounds);
+  drawLayerOverlay(block, layer, bounds, gui_painter);
+
+  debugPrint(logger_,
+             GUI,
+             "draw",
+             1,
+             "layer {} render {}",
+             layer->getName(),
+             layer_timer);
+}
+
+// Draws the design shapes on the layer.  These only depend on the design
+// and the display options so they can be cached in tiles.
+void RenderThread::drawLayerShapes(QPainter* painter,
+                                   odb::dbBlock* block,
+                                   dbTechLayer* layer,
+                                   const std::vector<dbInst*>& insts,
+                                   const Rect& bounds)
+{
+  if (!viewer_->options_->isVisible(layer)) {
+    return;
+  }
+
   const int shape_limit = viewer_->shapeSizeLimit();
 
   // Skip the cut layer if the cuts will be too small to see
-  const bool draw_shapes
-      = !(layer->getType() == dbTechLayerType::CUT
-          && viewer_->cut_maximum_size_[layer] < shape_limit);
+  const bool draw_shapes = !(layer->getType() == dbTechLayerType::CUT
+                             && cutMaximumSize(layer) < shape_limit);
   const bool layer_is_routing = layer->getType() == dbTechLayerType::CUT
                                 || layer->getType() == dbTechLayerType::ROUTING;
 
   if (draw_shapes) {
-    drawInstanceShapes(layer, painter, insts, bounds, gui_painter);
+    drawInstanceShapes(layer, painter, insts, bounds);
   }
 
   drawObstructions(block, layer, painter, bounds);
@@ -952,12 +1012,12 @@ void RenderThread::drawLayer(QPainter* painter,
         // will be too small based on the cut size (enclosure shapes
         // are generally only slightly larger).
         if (auto upper = layer->getUpperLayer()) {
-          if (viewer_->cut_maximum_size_[upper] >= shape_limit) {
+          if (cutMaximumSize(upper) >= shape_limit) {
             drawViaShapes(painter, block, upper, layer, bounds, shape_limit);
           }
         }
         if (auto lower = layer->getLowerLayer()) {
-          if (viewer_->cut_maximum_size_[lower] >= shape_limit) {
+          if (cutMaximumSize(lower) >= shape_limit) {
             drawViaShapes(painter, block, lower, layer, bounds, shape_limit);
           }
         }
@@ -1015,8 +1075,27 @@ void RenderThread::drawLayer(QPainter* painter,
         painter->drawRect(QRect(ll.x(), ll.y(), box.dx(), box.dy()));
       }
     }
+
+    drawTracks(layer, painter, bounds);
+  }
+}
+
+// Draws what is drawn on top of the layer's shapes but may change
+// without the design changing (pins depend on the view size, guides and
+// renderers are set by other tools) so it is never cached.
+void RenderThread::drawLayerOverlay(odb::dbBlock* block,
+                                    dbTechLayer* layer,
+                                    const Rect& bounds,
+                                    GuiPainter& gui_painter)
+{
+  if (!viewer_->options_->isVisible(layer)) {
+    return;
   }
 
+  const bool draw_shapes
+      = !(layer->getType() == dbTechLayerType::CUT
+          && cutMaximumSize(layer) < viewer_->shapeSizeLimit());
+
   if (draw_shapes) {
     if (viewer_->options_->areIOPinsVisible()) {
       utl::Timer io_pins;
@@ -1030,7 +1109,6 @@ void RenderThread::drawLayer(QPainter* painter,
                  io_pins);
     }
 
-    drawTracks(layer, painter, bounds);
     drawRouteGuides(gui_painter, layer);
     drawNetTracks(gui_painter, layer);
   }
@@ -1043,33 +1121,14 @@ void RenderThread::drawLayer(QPainter* painter,
     renderer->drawLayer(layer, gui_painter);
     gui_painter.restoreState();
   }
-  debugPrint(logger_,
-             GUI,
-             "draw",
-             1,
-             "layer {} render {}",
-             layer->getName(),
-             layer_timer);
 }
 
-// Draw the region of the block.  Depth is not yet used but
-// is there for hierarchical design support.
-void RenderThread::drawBlock(QPainter* painter,
-                             dbBlock* block,
-                             const Rect& bounds,
-                             int depth)
+// Draws what lies below all the layers.
+void RenderThread::drawBlockBase(QPainter* painter,
+                                 dbBlock* block,
+                                 const std::vector<dbInst*>& insts,
+                                 const Rect& bounds)
 {
-  utl::Timer timer;
-
-  utl::Timer manufacturing_grid_timer;
-  const int instance_limit = viewer_->instanceSizeLimit();
-
-  GuiPainter gui_painter(painter,
-                         viewer_->options_,
-                         bounds,
-                         viewer_->pixels_per_dbu_,
-                         block->getDbUnitsPerMicron());
-
   // Draw die area, if set
   painter->setPen(QPen(Qt::gray, 0));
   painter->setBrush(QBrush());
@@ -1079,26 +1138,23 @@ void RenderThread::drawBlock(QPainter* painter,
   }
 
   drawManufacturingGrid(painter, bounds);
-  debugPrint(logger_,
-             GUI,
-             "draw",
-             1,
-             "manufacturing grid {}",
-             manufacturing_grid_timer);
+  drawInstanceOutlines(painter, insts);
+  drawBlockages(painter, block, bounds);
+}
 
-  utl::Timer inst_timer;
+std::vector<dbInst*> RenderThread::visibleInsts(dbBlock* block,
+                                                const Rect& bounds)
+{
   auto inst_range = viewer_->search_.searchInsts(block,
                                                  bounds.xMin(),
                                                  bounds.yMin(),
                                                  bounds.xMax(),
                                                  bounds.yMax(),
-                                                 instance_limit);
+                                                 viewer_->instanceSizeLimit());
 
-  // Cache the search results as we will iterate over the instances
-  // for each layer.
   std::vector<dbInst*> insts;
   insts.reserve(10000);
-  for (auto* inst : inst_range) {
+  for (const auto& [box, inst] : inst_range) {
     if (restart_) {
       break;
     }
@@ -1106,21 +1162,306 @@ void RenderThread::drawBlock(QPainter* painter,
       insts.push_back(inst);
     }
   }
+  return insts;
+}
+
+static bool isTransparent(const QImage& image)
+{
+  for (int y = 0; y < image.height(); y++) {
+    const QRgb* line = reinterpret_cast<const QRgb*>(image.constScanLine(y));
+    for (int x = 0; x < image.width(); x++) {
+      if (line[x] != 0) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+QRect RenderThread::tileRect(const TileIndex& index) const
+{
+  return QRect(
+      index.first * kTileSize, index.second * kTileSize, kTileSize, kTileSize);
+}
+
+// Render the base and every layer of one tile into their own images.
+// Layers with nothing drawn in the tile keep a null image.
+void RenderThread::renderTile(Tile& tile,
+                              const QRect& tile_rect,
+                              dbBlock* block,
+                              const std::vector<dbTechLayer*>& layers)
+{
+  // Shapes only touching the last pixel column or row of the tile are
+  // outside of its dbu bounds, so search a pixel further.
+  Rect bounds = viewer_->screenToDBU(tile_rect);
+  bounds.bloat(std::ceil(1.0 / viewer_->pixels_per_dbu_), bounds);
+
+  auto draw = [&](QImage& image, const auto& draw_function) {
+    image = QImage(kTileSize, kTileSize, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    {
+      QPainter painter(&image);
+      painter.setRenderHints(QPainter::Antialiasing);
+      painter.translate(-tile_rect.topLeft());
+      painter.translate(viewer_->centering_shift_);
+      painter.scale(viewer_->pixels_per_dbu_, -viewer_->pixels_per_dbu_);
+      draw_function(&painter);
+    }
+    if (isTransparent(image)) {
+      image = QImage();
+    } else {
+      tile.bytes += image.bytesPerLine() * image.height();
+    }
+  };
+
+  const std::vector<dbInst*> insts = visibleInsts(block, bounds);
+
+  draw(tile.base, [&](QPainter* painter) {
+    drawBlockBase(painter, block, insts, bounds);
+  });
+
+  tile.layers.resize(layers.size());
+  for (int i = 0; i < layers.size(); i++) {
+    if (restart_) {
+      return;
+    }
+    dbTechLayer* layer = layers[i];
+    if (!viewer_->options_->isVisible(layer)) {
+      continue;
+    }
+    draw(tile.layers[i], [&](QPainter* painter) {
+      drawLayerShapes(painter, block, layer, insts, bounds);
+    });
+  }
+}
+
+// Keep the cache within its limit by dropping the tiles furthest from
+// the area being drawn.
+void RenderThread::trimTiles(const QRect& keep_area)
+{
+  if (tiles_bytes_ <= kTileCacheLimit) {
+    return;
+  }
+
+  const QPoint center = keep_area.center();
+  std::vector<std::pair<int, TileIndex>> candidates;
+  for (const auto& [index, tile] : tiles_) {
+    const QRect rect = tileRect(index);
+    if (!rect.intersects(keep_area)) {
+      candidates.emplace_back((rect.center() - center).manhattanLength(),
+                              index);
+    }
+  }
+  std::sort(candidates.begin(),
+            candidates.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.first > rhs.first;
+            });
+
+  for (const auto& [distance, index] : candidates) {
+    if (tiles_bytes_ <= kTileCacheLimit) {
+      break;
+    }
+    auto it = tiles_.find(index);
+    tiles_bytes_ -= it->second.bytes;
+    tiles_.erase(it);
+  }
+}
+
+void RenderThread::invalidateTiles(const std::vector<odb::Rect>& regions)
+{
+  std::lock_guard<std::mutex> lock(modified_regions_mutex_);
+  modified_regions_.insert(
+      modified_regions_.end(), regions.begin(), regions.end());
+}
+
+// Drop the cached tiles overlapping the areas edited since the last
+// render.  Tiles rendered while an edit arrives are dropped by the next
+// render, which will still see the area as modified.
+void RenderThread::dropModifiedTiles()
+{
+  std::vector<Rect> regions;
+  {
+    std::lock_guard<std::mutex> lock(modified_regions_mutex_);
+    regions.swap(modified_regions_);
+  }
+  if (regions.empty() || tiles_.empty()) {
+    return;
+  }
+
+  // Antialiasing and outlines may touch a pixel beyond a shape.
+  const int margin = 2;
+  std::vector<QRect> dirty;
+  dirty.reserve(regions.size());
+  for (const Rect& region : regions) {
+    const QPointF top_left(
+        tiles_centering_shift_.x() + region.xMin() * tiles_pixels_per_dbu_,
+        tiles_centering_shift_.y() - region.yMax() * tiles_pixels_per_dbu_);
+    const QPointF bottom_right(
+        tiles_centering_shift_.x() + region.xMax() * tiles_pixels_per_dbu_,
+        tiles_centering_shift_.y() - region.yMin() * tiles_pixels_per_dbu_);
+    dirty.push_back(QRectF(top_left, bottom_right)
+                        .toAlignedRect()
+                        .adjusted(-margin, -margin, margin, margin));
+  }
+
+  int dropped = 0;
+  for (auto it = tiles_.begin(); it != tiles_.end();) {
+    const QRect rect = tileRect(it->first);
+    const bool modified
+        = std::any_of(dirty.begin(), dirty.end(), [&](const QRect& area) {
+            return area.intersects(rect);
+          });
+    if (modified) {
+      tiles_bytes_ -= it->second.bytes;
+      it = tiles_.erase(it);
+      dropped++;
+    } else {
+      ++it;
+    }
+  }
+  debugPrint(logger_,
+             GUI,
+             "draw",
+             1,
+             "dropped {} tiles for {} modified regions",
+             dropped,
+             regions.size());
+}
+
+// Draw the base and layers from the tile cache, rendering the missing
+// tiles in parallel.  The uncached layer overlays are drawn directly
+// after each layer to keep the same stacking as without tiles.
+void RenderThread::drawTiles(QPainter* painter,
+                             dbBlock* block,
+                             const std::vector<dbTechLayer*>& layers,
+                             const Rect& bounds,
+                             const QRect& tile_area,
+                             GuiPainter& gui_painter)
+{
+  utl::Timer tiles_timer;
+
+  const int generation = tile_generation_;
+  if (generation != tiles_generation_
+      || tiles_pixels_per_dbu_ != viewer_->pixels_per_dbu_
+      || tiles_centering_shift_ != viewer_->centering_shift_
+      || tiles_layers_ != layers) {
+    tiles_.clear();
+    tiles_bytes_ = 0;
+    tiles_generation_ = generation;
+    tiles_pixels_per_dbu_ = viewer_->pixels_per_dbu_;
+    tiles_centering_shift_ = viewer_->centering_shift_;
+    tiles_layers_ = layers;
+  }
+  dropModifiedTiles();
+
+  const int col_lo = std::floor(tile_area.left() / double(kTileSize));
+  const int col_hi = std::floor(tile_area.right() / double(kTileSize));
+  const int row_lo = std::floor(tile_area.top() / double(kTileSize));
+  const int row_hi = std::floor(tile_area.bottom() / double(kTileSize));
+
+  std::vector<TileIndex> visible;
+  std::vector<TileIndex> missing;
+  for (int col = col_lo; col <= col_hi; col++) {
+    for (int row = row_lo; row <= row_hi; row++) {
+      visible.emplace_back(col, row);
+      if (tiles_.find(visible.back()) == tiles_.end()) {
+        missing.push_back(visible.back());
+      }
+    }
+  }
+
+  // The tile workers search the instance trees concurrently, so apply any
+  // pending changes to them here first.
+  viewer_->search_.prepareInsts(block);
+
+  std::vector<Tile> rendered(missing.size());
+  utl::ThreadException exception;
+  const int threads = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int i = 0; i < missing.size(); i++) {
+    if (restart_) {
+      continue;
+    }
+    try {
+      renderTile(rendered[i], tileRect(missing[i]), block, layers);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  if (restart_) {
+    // The tiles may be incomplete and the image is discarded anyway.
+    return;
+  }
+
+  for (int i = 0; i < missing.size(); i++) {
+    tiles_bytes_ += rendered[i].bytes;
+    tiles_[missing[i]] = std::move(rendered[i]);
+  }
+  debugPrint(logger_,
+             GUI,
+             "draw",
+             1,
+             "tiles rendered {} of {} in {}",
+             missing.size(),
+             visible.size(),
+             tiles_timer);
+
+  auto draw_images = [&](const auto& get_image) {
+    painter->save();
+    painter->resetTransform();
+    painter->translate(-tile_area.topLeft());
+    for (const TileIndex& index : visible) {
+      const QImage& image = get_image(tiles_.at(index));
+      if (!image.isNull()) {
+        painter->drawImage(tileRect(index).topLeft(), image);
+      }
+    }
+    painter->restore();
+  };
+
+  draw_images([](const Tile& tile) -> const QImage& { return tile.base; });
+  for (int i = 0; i < layers.size(); i++) {
+    if (restart_) {
+      break;
+    }
+    draw_images(
+        [i](const Tile& tile) -> const QImage& { return tile.layers[i]; });
+    drawLayerOverlay(block, layers[i], bounds, gui_painter);
+  }
+
+  trimTiles(tile_area);
+}
+
+// Draw the region of the block.  Depth is not yet used but
+// is there for hierarchical design support.  When tile_area is given the
+// design shapes are drawn through the tile cache.
+void RenderThread::drawBlock(QPainter* painter,
+                             dbBlock* block,
+                             const Rect& bounds,
+                             int depth,
+                             const QRect* tile_area)
+{
+  utl::Timer timer;
+
+  GuiPainter gui_painter(painter,
+                         viewer_->options_,
+                         bounds,
+                         viewer_->pixels_per_dbu_,
+                         block->getDbUnitsPerMicron());
+
+  // Cache the search results as we will iterate over the instances
+  // for each layer.
+  utl::Timer inst_timer;
+  const std::vector<dbInst*> insts = visibleInsts(block, bounds);
   debugPrint(logger_, GUI, "draw", 1, "inst search {}", inst_timer);
 
   utl::Timer io_pins_setup;
   setupIOPins(block, bounds);
   debugPrint(logger_, GUI, "draw", 1, "io pins setup {}", io_pins_setup);
 
-  utl::Timer insts_outline;
-  drawInstanceOutlines(painter, insts);
-  debugPrint(logger_, GUI, "draw", 1, "inst outline render {}", insts_outline);
-
-  // draw blockages
-  utl::Timer inst_blockages;
-  drawBlockages(painter, block, bounds);
-  debugPrint(logger_, GUI, "draw", 1, "blockages {}", inst_blockages);
-
   dbTech* tech = block->getTech();
   std::set<dbTech*> child_techs;
   for (auto child : block->getChildren()) {
@@ -1130,8 +1471,24 @@ void RenderThread::drawBlock(QPainter* painter,
     }
   }
 
+  std::vector<dbTechLayer*> layers;
   for (dbTech* child_tech : child_techs) {
     for (dbTechLayer* layer : child_tech->getLayers()) {
+      layers.push_back(layer);
+    }
+  }
+  for (dbTechLayer* layer : tech->getLayers()) {
+    layers.push_back(layer);
+  }
+
+  if (tile_area != nullptr) {
+    drawTiles(painter, block, layers, bounds, *tile_area, gui_painter);
+  } else {
+    utl::Timer base_timer;
+    drawBlockBase(painter, block, insts, bounds);
+    debugPrint(logger_, GUI, "draw", 1, "base render {}", base_timer);
+
+    for (dbTechLayer* layer : layers) {
       if (restart_) {
         break;
       }
@@ -1139,13 +1496,6 @@ void RenderThread::drawBlock(QPainter* painter,
     }
   }
 
-  for (dbTechLayer* layer : tech->getLayers()) {
-    if (restart_) {
-      break;
-    }
-    drawLayer(painter, block, layer, insts, bounds, gui_painter);
-  }
-
   utl::Timer inst_names;
   drawInstanceNames(painter, insts);
   debugPrint(logger_, GUI, "draw", 1, "instance names {}", inst_names);
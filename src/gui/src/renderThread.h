@@ -36,7 +36,11 @@
 #include <QPainter>
 #include <QThread>
 #include <QWaitCondition>
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "gui/gui.h"
 #include "odb/db.h"
@@ -76,24 +80,82 @@ class RenderThread : public QThread
   bool isFirstRenderDone() { return is_first_render_done_; };
   bool isRendering() { return is_rendering_; };
 
+  // Drop the cached layout tiles.  Must be called whenever anything
+  // drawn into the tiles (design, display options) may have changed.
+  void invalidateTiles() { tile_generation_++; }
+  // Drop only the cached tiles overlapping these areas (in dbu) of the
+  // top block, for design edits with a known extent.
+  void invalidateTiles(const std::vector<odb::Rect>& regions);
+
  signals:
   void done(const QImage& image, const QRect& bounds);
 
  private:
+  // Layout shapes are rendered in fixed size tiles (in screen pixels)
+  // with one image per layer so renderers can still draw between layers.
+  // Tiles are reused while panning or when only the selection,
+  // highlights or rulers change.
+  struct Tile
+  {
+    QImage base;
+    std::vector<QImage> layers;  // indexed like the layers being drawn
+    qint64 bytes = 0;
+  };
+  using TileIndex = std::pair<int, int>;  // column, row
+
   void run() override;
 
+  void drawImage(QImage& image,
+                 const QRect& draw_bounds,
+                 const SelectionSet& selected,
+                 const HighlightSet& highlighted,
+                 const Rulers& rulers,
+                 qreal render_ratio,
+                 const QColor& background,
+                 bool use_tiles);
+
   void setupIOPins(odb::dbBlock* block, const odb::Rect& bounds);
 
   void drawBlock(QPainter* painter,
                  odb::dbBlock* block,
                  const odb::Rect& bounds,
-                 int depth);
+                 int depth,
+                 const QRect* tile_area);
+  void drawBlockBase(QPainter* painter,
+                     odb::dbBlock* block,
+                     const std::vector<odb::dbInst*>& insts,
+                     const odb::Rect& bounds);
   void drawLayer(QPainter* painter,
                  odb::dbBlock* block,
                  odb::dbTechLayer* layer,
                  const std::vector<odb::dbInst*>& insts,
                  const odb::Rect& bounds,
                  GuiPainter& gui_painter);
+  void drawLayerShapes(QPainter* painter,
+                       odb::dbBlock* block,
+                       odb::dbTechLayer* layer,
+                       const std::vector<odb::dbInst*>& insts,
+                       const odb::Rect& bounds);
+  void drawLayerOverlay(odb::dbBlock* block,
+                        odb::dbTechLayer* layer,
+                        const odb::Rect& bounds,
+                        GuiPainter& gui_painter);
+  void drawTiles(QPainter* painter,
+                 odb::dbBlock* block,
+                 const std::vector<odb::dbTechLayer*>& layers,
+                 const odb::Rect& bounds,
+                 const QRect& tile_area,
+                 GuiPainter& gui_painter);
+  void renderTile(Tile& tile,
+                  const QRect& tile_rect,
+                  odb::dbBlock* block,
+                  const std::vector<odb::dbTechLayer*>& layers);
+  void trimTiles(const QRect& keep_area);
+  void dropModifiedTiles();
+  QRect tileRect(const TileIndex& index) const;
+  int cutMaximumSize(odb::dbTechLayer* cut_layer) const;
+  std::vector<odb::dbInst*> visibleInsts(odb::dbBlock* block,
+                                         const odb::Rect& bounds);
   void drawRegions(QPainter* painter, odb::dbBlock* block);
   void drawTracks(odb::dbTechLayer* layer,
                   QPainter* painter,
@@ -104,8 +166,7 @@ class RenderThread : public QThread
   void drawInstanceShapes(odb::dbTechLayer* layer,
                           QPainter* painter,
                           const std::vector<odb::dbInst*>& insts,
-                          const odb::Rect& bounds,
-                          GuiPainter& gui_painter);
+                          const odb::Rect& bounds);
   void drawInstanceNames(QPainter* painter,
                          const std::vector<odb::dbInst*>& insts);
   void drawITermLabels(QPainter* painter,
@@ -183,6 +244,21 @@ class RenderThread : public QThread
   std::map<odb::dbTechLayer*,
            std::vector<std::pair<odb::dbBTerm*, odb::dbBox*>>>
       pins_;
+
+  // Tile cache, only accessed from the render thread.  The cached tiles
+  // are valid for a single resolution, centering and generation.
+  static constexpr int kTileSize = 256;                        // pixels
+  static constexpr qint64 kTileCacheLimit = 512 * 1024 * 1024;  // bytes
+  std::map<TileIndex, Tile> tiles_;
+  qint64 tiles_bytes_ = 0;
+  qreal tiles_pixels_per_dbu_ = 0;
+  QPoint tiles_centering_shift_;
+  std::vector<odb::dbTechLayer*> tiles_layers_;
+  int tiles_generation_ = -1;
+  std::atomic<int> tile_generation_{0};
+  // Areas edited since the last render, guarded by modified_regions_mutex_
+  std::mutex modified_regions_mutex_;
+  std::vector<odb::Rect> modified_regions_;
 };
 
 }  // namespace gui
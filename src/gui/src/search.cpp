@@ -32,10 +32,14 @@
 
 #include "search.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <tuple>
 #include <utility>
 
 #include "odb/dbShape.h"
+#include "ord/OpenRoad.hh"
 
 namespace gui {
 
@@ -46,22 +50,48 @@ Search::~Search()
   }
 }
 
+// The area covered by the routing and special wiring of a net.
+static odb::Rect netWiringBBox(odb::dbNet* net)
+{
+  odb::Rect bbox;
+  bbox.mergeInit();
+  if (odb::dbWire* wire = net->getWire()) {
+    if (const auto wire_bbox = wire->getBBox()) {
+      bbox.merge(*wire_bbox);
+    }
+  }
+  for (odb::dbSWire* swire : net->getSWires()) {
+    for (odb::dbSBox* box : swire->getWires()) {
+      bbox.merge(box->getBox());
+    }
+  }
+  return bbox;
+}
+
 void Search::inDbNetDestroy(odb::dbNet* net)
 {
   clearShapes();
+  markModified(netWiringBBox(net));
 }
 
 void Search::inDbInstDestroy(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    updateInst(inst, false);
+  }
+}
+
+void Search::inDbInstSwapMasterBefore(odb::dbInst* inst, odb::dbMaster* master)
+{
+  if (inst->isPlaced()) {
+    updateInst(inst, false);
   }
 }
 
 void Search::inDbInstSwapMasterAfter(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    updateInst(inst, true);
   }
 }
 
@@ -69,75 +99,148 @@ void Search::inDbInstPlacementStatusBefore(odb::dbInst* inst,
                                            const odb::dbPlacementStatus& status)
 {
   if (inst->getPlacementStatus().isPlaced() != status.isPlaced()) {
-    clearInsts();
+    updateInst(inst, status.isPlaced());
+  }
+}
+
+void Search::inDbPreMoveInst(odb::dbInst* inst)
+{
+  if (inst->isPlaced()) {
+    updateInst(inst, false);
   }
 }
 
 void Search::inDbPostMoveInst(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
+    updateInst(inst, true);
+  }
+}
+
+// Queue an instance to be inserted into or removed from the instance
+// tree with its current bounding box.  The queue is applied by the next
+// search so, as with a rebuild, the tree is only changed by searches.
+void Search::updateInst(odb::dbInst* inst, bool insert)
+{
+  const odb::Rect bbox = inst->getBBox()->getBox();
+  markModified(bbox);
+
+  BlockData& data = top_block_data_;
+  bool rebuild = false;
+  {
+    std::lock_guard<std::mutex> lock(data.insts_init_mutex_);
+    if (!data.insts_init_) {
+      return;  // the whole tree is rebuilt by the next search
+    }
+    const size_t limit
+        = std::max(kMinIncrementalLimit, data.insts_.size() / 8);
+    if (data.insts_updates_.size() >= limit) {
+      data.insts_updates_.clear();
+      data.insts_updated_ = false;
+      rebuild = true;
+    } else {
+      data.insts_updates_.push_back({insert, {bbox, inst}});
+      data.insts_updated_ = true;
+    }
+  }
+
+  if (rebuild) {
     clearInsts();
   }
 }
 
 void Search::inDbBPinCreate(odb::dbBPin* pin)
 {
+  // The pin has no boxes yet and they are added without callbacks.
   clearShapes();
+  markModified();
 }
 
 void Search::inDbBPinDestroy(odb::dbBPin* pin)
 {
   clearShapes();
+  markModified(pin->getBBox());
 }
 
 void Search::inDbFillCreate(odb::dbFill* fill)
 {
   clearFills();
+  odb::Rect rect;
+  fill->getRect(rect);
+  markModified(rect);
 }
 
 void Search::inDbWireCreate(odb::dbWire* wire)
 {
+  // A new wire is empty, its shapes arrive with inDbWirePostModify.
   clearShapes();
 }
 
 void Search::inDbWireDestroy(odb::dbWire* wire)
 {
   clearShapes();
+  if (const auto bbox = wire->getBBox()) {
+    markModified(*bbox);
+  }
+}
+
+void Search::inDbWirePreModify(odb::dbWire* wire)
+{
+  if (const auto bbox = wire->getBBox()) {
+    markModified(*bbox);
+  }
+}
+
+void Search::inDbWirePostModify(odb::dbWire* wire)
+{
+  clearShapes();
+  if (const auto bbox = wire->getBBox()) {
+    markModified(*bbox);
+  }
 }
 
 void Search::inDbSWireCreate(odb::dbSWire* wire)
 {
+  // A new special wire is empty, its boxes arrive with inDbSWireAddSBox.
   clearShapes();
 }
 
 void Search::inDbSWireDestroy(odb::dbSWire* wire)
 {
   clearShapes();
+  for (odb::dbSBox* box : wire->getWires()) {
+    markModified(box->getBox());
+  }
 }
 
 void Search::inDbSWireAddSBox(odb::dbSBox* box)
 {
   clearShapes();
+  markModified(box->getBox());
 }
 
 void Search::inDbSWireRemoveSBox(odb::dbSBox* box)
 {
   clearShapes();
+  markModified(box->getBox());
 }
 
 void Search::inDbBlockageCreate(odb::dbBlockage* blockage)
 {
   clearBlockages();
+  markModified(blockage->getBBox()->getBox());
 }
 
 void Search::inDbObstructionCreate(odb::dbObstruction* obs)
 {
   clearObstructions();
+  markModified(obs->getBBox()->getBox());
 }
 
 void Search::inDbObstructionDestroy(odb::dbObstruction* obs)
 {
   clearObstructions();
+  markModified(obs->getBBox()->getBox());
 }
 
 void Search::inDbBlockSetDieArea(odb::dbBlock* block)
@@ -145,29 +248,28 @@ void Search::inDbBlockSetDieArea(odb::dbBlock* block)
   setTopBlock(block);
 }
 
-void Search::inDbRegionAddBox(odb::dbRegion*, odb::dbBox*)
+void Search::inDbRegionAddBox(odb::dbRegion*, odb::dbBox* box)
 {
-  emit modified();
+  markModified(box->getBox());
 }
 
 void Search::inDbRegionDestroy(odb::dbRegion* region)
 {
-  emit modified();
+  for (odb::dbBox* box : region->getBoundaries()) {
+    markModified(box->getBox());
+  }
 }
 
 void Search::inDbRowCreate(odb::dbRow* row)
 {
   clearRows();
+  markModified(row->getBBox());
 }
 
 void Search::inDbRowDestroy(odb::dbRow* row)
 {
   clearRows();
-}
-
-void Search::inDbWirePostModify(odb::dbWire* wire)
-{
-  clearShapes();
+  markModified(row->getBBox());
 }
 
 void Search::setTopBlock(odb::dbBlock* block)
@@ -195,15 +297,58 @@ void Search::setTopBlock(odb::dbBlock* block)
   emit newBlock(block);
 }
 
-void Search::announceModified(std::atomic_bool& flag)
+// Record an area of the top block whose drawing changed.  Only the first
+// change after takeModifiedRegions is announced; later ones are collected
+// until the viewer takes them.
+void Search::markModified(const odb::Rect& region)
 {
-  const bool prev_flag = flag.exchange(false);
+  if (region.isInverted()) {
+    return;
+  }
+  bool announce = false;
+  {
+    std::lock_guard<std::mutex> lock(modified_mutex_);
+    if (modified_all_) {
+      return;
+    }
+    announce = modified_regions_.empty();
+    if (modified_regions_.size() >= kMaxModifiedRegions) {
+      modified_regions_.clear();
+      modified_all_ = true;
+    } else {
+      modified_regions_.push_back(region);
+    }
+  }
+  if (announce) {
+    emit modified();
+  }
+}
 
-  if (prev_flag) {
+// Record that anything in the top block may have changed.
+void Search::markModified()
+{
+  bool announce = false;
+  {
+    std::lock_guard<std::mutex> lock(modified_mutex_);
+    announce = !modified_all_ && modified_regions_.empty();
+    modified_regions_.clear();
+    modified_all_ = true;
+  }
+  if (announce) {
     emit modified();
   }
 }
 
+bool Search::takeModifiedRegions(std::vector<odb::Rect>& regions)
+{
+  std::lock_guard<std::mutex> lock(modified_mutex_);
+  const bool bounded = !modified_all_;
+  regions = std::move(modified_regions_);
+  modified_regions_.clear();
+  modified_all_ = false;
+  return bounded;
+}
+
 void Search::clear()
 {
   child_block_data_.clear();
@@ -213,41 +358,46 @@ void Search::clear()
   clearBlockages();
   clearObstructions();
   clearRows();
+  markModified();
 }
 
 void Search::clearShapes()
 {
-  announceModified(top_block_data_.shapes_init_);
+  top_block_data_.shapes_init_ = false;
 }
 
 void Search::clearFills()
 {
-  announceModified(top_block_data_.fills_init_);
+  top_block_data_.fills_init_ = false;
 }
 
 void Search::clearInsts()
 {
-  announceModified(top_block_data_.insts_init_);
+  top_block_data_.insts_init_ = false;
 }
 
 void Search::clearBlockages()
 {
-  announceModified(top_block_data_.blockages_init_);
+  top_block_data_.blockages_init_ = false;
 }
 
 void Search::clearObstructions()
 {
-  announceModified(top_block_data_.obstructions_init_);
+  top_block_data_.obstructions_init_ = false;
 }
 
 void Search::clearRows()
 {
-  announceModified(top_block_data_.rows_init_);
+  top_block_data_.rows_init_ = false;
 }
 
 Search::BlockData& Search::getData(odb::dbBlock* block)
 {
-  return block == top_block_ ? top_block_data_ : child_block_data_[block];
+  if (block == top_block_) {
+    return top_block_data_;
+  }
+  std::lock_guard<std::mutex> lock(child_block_data_mutex_);
+  return child_block_data_[block];
 }
 
 void Search::updateShapes(odb::dbBlock* block)
@@ -267,15 +417,9 @@ void Search::updateShapes(odb::dbBlock* block)
   for (odb::dbNet* net : block->getNets()) {
     addSNet(net, snet_shapes, snet_net_via_shapes);
   }
-  for (const auto& [layer, layer_shapes] : snet_shapes) {
-    data.snet_shapes_[layer] = RtreeSNetShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
+  buildLayerTrees(snet_shapes, data.snet_shapes_);
   snet_shapes.clear();
-  for (const auto& [layer, layer_shapes] : snet_net_via_shapes) {
-    data.snet_via_shapes_[layer] = RtreeSNetDBoxShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
+  buildLayerTrees(snet_net_via_shapes, data.snet_via_shapes_);
   snet_net_via_shapes.clear();
 
   LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>> net_shapes;
@@ -299,10 +443,7 @@ void Search::updateShapes(odb::dbBlock* block)
       }
     }
   }
-  for (const auto& [layer, layer_shapes] : net_shapes) {
-    data.box_shapes_[layer] = RtreeRoutingShapes<odb::dbNet*>(
-        layer_shapes.begin(), layer_shapes.end());
-  }
+  buildLayerTrees(net_shapes, data.box_shapes_);
 
   data.shapes_init_ = true;
 }
@@ -321,9 +462,7 @@ void Search::updateFills(odb::dbBlock* block)
   for (odb::dbFill* fill : block->getFills()) {
     fills[fill->getTechLayer()].push_back(fill);
   }
-  for (const auto& [layer, layer_fill] : fills) {
-    data.fills_[layer] = RtreeFill(layer_fill.begin(), layer_fill.end());
-  }
+  buildLayerTrees(fills, data.fills_);
 
   data.fills_init_ = true;
 }
@@ -337,18 +476,40 @@ void Search::updateInsts(odb::dbBlock* block)
   }
 
   data.insts_.clear();
+  data.insts_updates_.clear();
+  data.insts_updated_ = false;
 
-  std::vector<odb::dbInst*> insts;
+  std::vector<RectValue<odb::dbInst*>> insts;
   for (odb::dbInst* inst : block->getInsts()) {
     if (inst->isPlaced()) {
-      insts.push_back(inst);
+      insts.emplace_back(inst->getBBox()->getBox(), inst);
     }
   }
-  data.insts_ = RtreeDBox<odb::dbInst*>(insts.begin(), insts.end());
+  data.insts_ = RtreeRect<odb::dbInst*>(insts.begin(), insts.end());
 
   data.insts_init_ = true;
 }
 
+void Search::applyInstUpdates(odb::dbBlock* block)
+{
+  BlockData& data = getData(block);
+  std::lock_guard<std::mutex> lock(data.insts_init_mutex_);
+  if (!data.insts_updated_) {
+    return;  // already done by another thread
+  }
+
+  for (const InstUpdate& update : data.insts_updates_) {
+    if (update.insert) {
+      data.insts_.insert(update.value);
+    } else {
+      data.insts_.remove(update.value);
+    }
+  }
+  data.insts_updates_.clear();
+
+  data.insts_updated_ = false;
+}
+
 void Search::updateBlockages(odb::dbBlock* block)
 {
   BlockData& data = getData(block);
@@ -384,10 +545,7 @@ void Search::updateObstructions(odb::dbBlock* block)
     odb::dbBox* bbox = obs->getBBox();
     obstructions[bbox->getTechLayer()].push_back(obs);
   }
-  for (const auto& [layer, layer_obs] : obstructions) {
-    data.obstructions_[layer]
-        = RtreeDBox<odb::dbObstruction*>(layer_obs.begin(), layer_obs.end());
-  }
+  buildLayerTrees(obstructions, data.obstructions_);
 
   data.obstructions_init_ = true;
 }
@@ -411,6 +569,27 @@ void Search::updateRows(odb::dbBlock* block)
   data.rows_init_ = true;
 }
 
+// The range constructor packs (bulk loads) each tree.  The layers are
+// independent so their trees are built in parallel.
+template <typename Tree>
+void Search::buildLayerTrees(
+    const LayerMap<std::vector<typename Tree::value_type>>& values,
+    LayerMap<Tree>& trees)
+{
+  std::vector<std::pair<Tree*, const std::vector<typename Tree::value_type>*>>
+      builds;
+  for (const auto& [layer, layer_values] : values) {
+    builds.emplace_back(&trees[layer], &layer_values);
+  }
+
+  const int threads = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int i = 0; i < builds.size(); i++) {
+    auto& [tree, layer_values] = builds[i];
+    *tree = Tree(layer_values->begin(), layer_values->end());
+  }
+}
+
 void Search::addVia(
     odb::dbNet* net,
     odb::dbShape* shape,
@@ -718,6 +897,19 @@ Search::FillRange Search::searchFills(odb::dbBlock* block,
   return FillRange(rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
+void Search::prepareInsts(odb::dbBlock* block)
+{
+  BlockData& data = getData(block);
+  if (!data.insts_init_) {
+    updateInsts(block);
+  } else if (data.insts_updated_) {
+    applyInstUpdates(block);
+  }
+  for (odb::dbBlock* child : block->getChildren()) {
+    prepareInsts(child);
+  }
+}
+
 Search::InstRange Search::searchInsts(odb::dbBlock* block,
                                       int x_lo,
                                       int y_lo,
@@ -726,8 +918,13 @@ Search::InstRange Search::searchInsts(odb::dbBlock* block,
                                       int min_height)
 {
   BlockData& data = getData(block);
-  if (!data.insts_init_) {
-    updateInsts(block);
+  // Parallel tile workers only read the tree while others iterate it.
+  if (!omp_in_parallel()) {
+    if (!data.insts_init_) {
+      updateInsts(block);
+    } else if (data.insts_updated_) {
+      applyInstUpdates(block);
+    }
   }
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
@@ -36,6 +36,7 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/index/rtree.hpp>
 #include <mutex>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
@@ -51,8 +52,9 @@ namespace bgi = boost::geometry::index;
 // rtree.  OpenDB also has some code for this purpose but I
 // find it confusing so just made a simpler solution for now.
 //
-// Currently this class is static once built and doesn't follow
-// db changes.  TODO: this should be into an observer of OpenDB.
+// The trees are bulk loaded on first use.  Instance changes reported by
+// the db callbacks are applied incrementally by the next search; other
+// changes drop the affected trees so they are rebuilt on the next search.
 class Search : public QObject, public odb::dbBlockCallBackObj
 {
   Q_OBJECT
@@ -140,7 +142,7 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     Iterator begin_;
     Iterator end_;
   };
-  using InstRange = Range<RtreeDBox<odb::dbInst*>>;
+  using InstRange = Range<RtreeRect<odb::dbInst*>>;
   using RoutingRange = Range<RtreeRoutingShapes<odb::dbNet*>>;
   using SNetSBoxRange = Range<RtreeSNetDBoxShapes<odb::dbNet*>>;
   using SNetShapeRange = Range<RtreeSNetShapes<odb::dbNet*>>;
@@ -194,6 +196,11 @@ class Search : public QObject, public odb::dbBlockCallBackObj
                         int y_hi,
                         int min_size = 0);
 
+  // Build the instance trees of the block and its children or apply their
+  // queued updates.  searchInsts leaves the trees untouched inside an
+  // OpenMP parallel region, so call this before searching from one.
+  void prepareInsts(odb::dbBlock* block);
+
   // Find all instances in the given bounds with height of at least min_height
   InstRange searchInsts(odb::dbBlock* block,
                         int x_lo,
@@ -235,19 +242,28 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void clearObstructions();
   void clearRows();
 
+  // Take the areas of the top block whose drawing changed since the last
+  // call.  Returns false when the change is not bounded and everything
+  // must be redrawn.
+  bool takeModifiedRegions(std::vector<odb::Rect>& regions);
+
   // From dbBlockCallBackObj
   void inDbNetDestroy(odb::dbNet* net) override;
   void inDbInstDestroy(odb::dbInst* inst) override;
+  void inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                odb::dbMaster* master) override;
   void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
   void inDbInstPlacementStatusBefore(
       odb::dbInst* inst,
       const odb::dbPlacementStatus& status) override;
+  void inDbPreMoveInst(odb::dbInst* inst) override;
   void inDbPostMoveInst(odb::dbInst* inst) override;
   void inDbBPinCreate(odb::dbBPin* pin) override;
   void inDbBPinDestroy(odb::dbBPin* pin) override;
   void inDbFillCreate(odb::dbFill* fill) override;
   void inDbWireCreate(odb::dbWire* wire) override;
   void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePreModify(odb::dbWire* wire) override;
   void inDbSWireCreate(odb::dbSWire* wire) override;
   void inDbSWireDestroy(odb::dbSWire* wire) override;
   void inDbSWireAddSBox(odb::dbSBox* box) override;
@@ -263,6 +279,7 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void inDbWirePostModify(odb::dbWire* wire) override;
 
  signals:
+  // The drawing of the top block changed, see takeModifiedRegions.
   void modified();
   void newBlock(odb::dbBlock* block);
 
@@ -287,13 +304,38 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void updateObstructions(odb::dbBlock* block);
   void updateRows(odb::dbBlock* block);
 
+  void updateInst(odb::dbInst* inst, bool insert);
+  void applyInstUpdates(odb::dbBlock* block);
+  template <typename Tree>
+  static void buildLayerTrees(
+      const LayerMap<std::vector<typename Tree::value_type>>& values,
+      LayerMap<Tree>& trees);
+
   void clear();
 
-  void announceModified(std::atomic_bool& flag);
+  void markModified(const odb::Rect& region);
+  void markModified();
   BlockData& getData(odb::dbBlock* block);
 
   odb::dbBlock* top_block_{nullptr};
 
+  // A pending incremental change to the instance tree
+  struct InstUpdate
+  {
+    bool insert;
+    RectValue<odb::dbInst*> value;
+  };
+
+  // Above this many pending changes (or 1/8 of the tree size) it is
+  // cheaper to rebuild the instance tree.
+  static constexpr size_t kMinIncrementalLimit = 1024;
+
+  // Above this many pending modified regions everything is redrawn.
+  static constexpr size_t kMaxModifiedRegions = 256;
+  std::mutex modified_mutex_;
+  std::vector<odb::Rect> modified_regions_;
+  bool modified_all_ = false;
+
   struct BlockData
   {
     // The net is used for filter shapes by net type
@@ -308,9 +350,11 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     LayerMap<RtreeFill> fills_;
     std::atomic_bool fills_init_{false};
     std::mutex fills_init_mutex_;
-    RtreeDBox<odb::dbInst*> insts_;
+    RtreeRect<odb::dbInst*> insts_;
     std::atomic_bool insts_init_{false};
     std::mutex insts_init_mutex_;
+    std::vector<InstUpdate> insts_updates_;
+    std::atomic_bool insts_updated_{false};
     RtreeDBox<odb::dbBlockage*> blockages_;
     std::atomic_bool blockages_init_{false};
     std::mutex blockages_init_mutex_;
@@ -322,6 +366,8 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     std::mutex rows_init_mutex_;
   };
   std::map<odb::dbBlock*, BlockData> child_block_data_;
+  // Guards insertion into child_block_data_ by concurrent searches
+  std::mutex child_block_data_mutex_;
   BlockData top_block_data_;
 };
 
@@ -404,10 +404,11 @@ class dbDatabase : public dbObject
   void read(std::istream& f);
 
   ///
-  /// Write a database to this stream.
+  /// Write a database to this stream. If compress is true the database is
+  /// written in block compressed form, which read() detects.
   /// Throws ZIOError..
   ///
-  void write(std::ostream& file);
+  void write(std::ostream& file, bool compress = false);
 
   ///
   /// ECO - The following methods implement a simple ECO mechanism for capturing
@@ -73,6 +73,8 @@ class defin
   void namesAreDBIDs();
   void setAssemblyMode();
   void useBlockName(const char* name);
+  // Read the DEF file on the parsing thread instead of a reader thread.
+  void disablePrefetch();
 
   /// Create a new chip
   dbChip* createChip(std::vector<dbLib*>& search_libs,
@@ -41,7 +41,7 @@ namespace odb {
 class dbBlock;
 class dbNet;
 
-void orderWires(utl::Logger* logger, dbBlock* b);
+void orderWires(utl::Logger* logger, dbBlock* b, int thread_count = 1);
 void orderWires(utl::Logger* logger, dbNet* net);
 
 }  // namespace odb
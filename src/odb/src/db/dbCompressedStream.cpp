@@ -0,0 +1,399 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbCompressedStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "odb/ZException.h"
+
+namespace odb {
+
+namespace {
+
+constexpr char kMagic[4] = {'O', 'D', 'B', 'Z'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kBlockSize = 1 << 20;
+constexpr uint32_t kMaxBlockSize = 1 << 26;
+
+enum BlockCodec : uint8_t
+{
+  kStored = 0,
+  kLz = 1
+};
+
+// LZ77 sequences in the style of LZ4: a token with the literal length in
+// the high nibble and the match length minus kMinMatch in the low nibble,
+// the literals, a 16 bit offset and the length extensions.  The last
+// sequence only has literals.
+constexpr int kMinMatch = 4;
+constexpr int kHashBits = 16;
+constexpr size_t kMaxOffset = 0xffff;
+
+uint32_t read32(const char* p)
+{
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+uint32_t hash32(const uint32_t v)
+{
+  return (v * 2654435761U) >> (32 - kHashBits);
+}
+
+void writeLength(std::vector<char>& dst, size_t length)
+{
+  while (length >= 255) {
+    dst.push_back((char) 255);
+    length -= 255;
+  }
+  dst.push_back((char) length);
+}
+
+bool readLength(const unsigned char*& in,
+                const unsigned char* end,
+                size_t& length)
+{
+  unsigned char byte;
+  do {
+    if (in == end) {
+      return false;
+    }
+    byte = *in++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+void writeSequence(std::vector<char>& dst,
+                   const char* literals,
+                   const size_t literal_length,
+                   const size_t offset,
+                   const size_t match_length)
+{
+  const size_t match_code = match_length - kMinMatch;
+  const unsigned char token = (std::min<size_t>(literal_length, 15) << 4)
+                              | std::min<size_t>(match_code, 15);
+  dst.push_back((char) token);
+  if (literal_length >= 15) {
+    writeLength(dst, literal_length - 15);
+  }
+  dst.insert(dst.end(), literals, literals + literal_length);
+  if (match_length == 0) {
+    return;
+  }
+  dst.push_back((char) (offset & 0xff));
+  dst.push_back((char) (offset >> 8));
+  if (match_code >= 15) {
+    writeLength(dst, match_code - 15);
+  }
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T value)
+{
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void readBytes(std::istream& stream, char* data, const size_t size)
+{
+  stream.read(data, size);
+  if (!stream || stream.gcount() != (std::streamsize) size) {
+    throw ZException("truncated compressed database block");
+  }
+}
+
+template <typename T>
+T readValue(std::istream& stream)
+{
+  T value{};
+  readBytes(stream, reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+void dbCompressBlock(const char* src,
+                     const size_t size,
+                     std::vector<int>& hash_table,
+                     std::vector<char>& dst)
+{
+  dst.clear();
+  hash_table.assign(1 << kHashBits, -1);
+
+  size_t anchor = 0;
+  size_t pos = 0;
+  while (pos + kMinMatch <= size) {
+    const uint32_t sequence = read32(src + pos);
+    int& entry = hash_table[hash32(sequence)];
+    const int candidate = entry;
+    entry = pos;
+    if (candidate < 0 || pos - candidate > kMaxOffset
+        || read32(src + candidate) != sequence) {
+      pos++;
+      continue;
+    }
+
+    size_t length = kMinMatch;
+    while (pos + length < size && src[candidate + length] == src[pos + length]) {
+      length++;
+    }
+    writeSequence(dst, src + anchor, pos - anchor, pos - candidate, length);
+    pos += length;
+    anchor = pos;
+  }
+  writeSequence(dst, src + anchor, size - anchor, 0, 0);
+}
+
+bool dbDecompressBlock(const char* src,
+                       const size_t size,
+                       const size_t raw_size,
+                       std::vector<char>& dst)
+{
+  dst.clear();
+  dst.reserve(raw_size);
+
+  const unsigned char* in = reinterpret_cast<const unsigned char*>(src);
+  const unsigned char* end = in + size;
+  while (in < end) {
+    const unsigned char token = *in++;
+    size_t literal_length = token >> 4;
+    if (literal_length == 15 && !readLength(in, end, literal_length)) {
+      return false;
+    }
+    if (literal_length > (size_t) (end - in)
+        || dst.size() + literal_length > raw_size) {
+      return false;
+    }
+    dst.insert(dst.end(), in, in + literal_length);
+    in += literal_length;
+    if (in == end) {
+      break;
+    }
+
+    if (end - in < 2) {
+      return false;
+    }
+    const size_t offset = in[0] | (in[1] << 8);
+    in += 2;
+    size_t match_length = token & 0xf;
+    if (match_length == 15 && !readLength(in, end, match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+    if (offset == 0 || offset > dst.size()
+        || dst.size() + match_length > raw_size) {
+      return false;
+    }
+    // The match may overlap the bytes it produces.
+    size_t from = dst.size() - offset;
+    for (size_t i = 0; i < match_length; i++) {
+      dst.push_back(dst[from++]);
+    }
+  }
+  return dst.size() == raw_size;
+}
+
+////////////////////////////////////////////////////////////////
+
+dbCompressedOStreamBuf::dbCompressedOStreamBuf(std::ostream& sink)
+    : sink_(sink), buffer_(kBlockSize)
+{
+  sink_.write(kMagic, sizeof(kMagic));
+  writeValue(sink_, kVersion);
+  writeValue(sink_, kBlockSize);
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+void dbCompressedOStreamBuf::finish()
+{
+  writeBlock();
+  writeValue<uint32_t>(sink_, 0);
+  sink_.flush();
+}
+
+dbCompressedOStreamBuf::int_type dbCompressedOStreamBuf::overflow(
+    const int_type ch)
+{
+  writeBlock();
+  if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+  }
+  return traits_type::not_eof(ch);
+}
+
+dbCompressedOStreamBuf::pos_type dbCompressedOStreamBuf::seekoff(
+    const off_type off,
+    const std::ios_base::seekdir dir,
+    const std::ios_base::openmode which)
+{
+  // Only reporting the position (tellp) is supported.
+  if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::out)) {
+    return pos_type(off_type(-1));
+  }
+  return pos_type(written_ + (pptr() - pbase()));
+}
+
+void dbCompressedOStreamBuf::writeBlock()
+{
+  const uint32_t raw_size = pptr() - pbase();
+  if (raw_size == 0) {
+    return;
+  }
+
+  dbCompressBlock(pbase(), raw_size, hash_table_, compressed_);
+  const bool stored = compressed_.size() >= raw_size;
+  const char* data = stored ? pbase() : compressed_.data();
+  const uint32_t stored_size = stored ? raw_size : compressed_.size();
+
+  writeValue(sink_, raw_size);
+  writeValue(sink_, stored_size);
+  writeValue<uint8_t>(sink_, stored ? kStored : kLz);
+  sink_.write(data, stored_size);
+
+  written_ += raw_size;
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+////////////////////////////////////////////////////////////////
+
+dbCompressedIStreamBuf::dbCompressedIStreamBuf(std::istream& source)
+    : source_(source)
+{
+  char magic[sizeof(kMagic)];
+  readBytes(source_, magic, sizeof(magic));
+  if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+    throw ZException("database file is not a compressed OpenDB Database");
+  }
+  const uint32_t version = readValue<uint32_t>(source_);
+  if (version > kVersion) {
+    throw ZException("compressed database version %u > %u is not supported",
+                     version,
+                     kVersion);
+  }
+  // The block size is informational; blocks carry their own sizes.
+  readValue<uint32_t>(source_);
+  setg(nullptr, nullptr, nullptr);
+}
+
+// Reads the magic directly from the stream buffer, so a short stream doesn't
+// change the stream state, and rewinds to where the stream was.
+bool dbCompressedIStreamBuf::isCompressed(std::istream& source)
+{
+  std::streambuf* buf = source.rdbuf();
+  if (buf == nullptr) {
+    return false;
+  }
+  const std::streampos start
+      = buf->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+  char magic[sizeof(kMagic)];
+  const std::streamsize count = buf->sgetn(magic, sizeof(magic));
+  const bool compressed
+      = count == sizeof(magic)
+        && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+  if (start != std::streampos(std::streamoff(-1))) {
+    buf->pubseekpos(start, std::ios_base::in);
+  } else {
+    // Not seekable; push the bytes back in reverse order.
+    for (std::streamsize i = count - 1; i >= 0; i--) {
+      buf->sputbackc(magic[i]);
+    }
+  }
+  return compressed;
+}
+
+dbCompressedIStreamBuf::int_type dbCompressedIStreamBuf::underflow()
+{
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+  if (!readBlock()) {
+    return traits_type::eof();
+  }
+  return traits_type::to_int_type(*gptr());
+}
+
+dbCompressedIStreamBuf::pos_type dbCompressedIStreamBuf::seekoff(
+    const off_type off,
+    const std::ios_base::seekdir dir,
+    const std::ios_base::openmode which)
+{
+  // Only reporting the position (tellg) is supported.
+  if (off != 0 || dir != std::ios_base::cur || !(which & std::ios_base::in)) {
+    return pos_type(off_type(-1));
+  }
+  return pos_type(read_ - (egptr() - gptr()));
+}
+
+bool dbCompressedIStreamBuf::readBlock()
+{
+  if (done_) {
+    return false;
+  }
+
+  const uint32_t raw_size = readValue<uint32_t>(source_);
+  if (raw_size == 0) {
+    done_ = true;
+    return false;
+  }
+  const uint32_t stored_size = readValue<uint32_t>(source_);
+  const uint8_t codec = readValue<uint8_t>(source_);
+  if (raw_size > kMaxBlockSize || stored_size > kMaxBlockSize) {
+    throw ZException("corrupt compressed database block");
+  }
+
+  if (codec == kStored) {
+    if (stored_size != raw_size) {
+      throw ZException("corrupt compressed database block");
+    }
+    buffer_.resize(raw_size);
+    readBytes(source_, buffer_.data(), raw_size);
+  } else if (codec == kLz) {
+    compressed_.resize(stored_size);
+    readBytes(source_, compressed_.data(), stored_size);
+    if (!dbDecompressBlock(
+            compressed_.data(), stored_size, raw_size, buffer_)) {
+      throw ZException("corrupt compressed database block");
+    }
+  } else {
+    throw ZException("unknown compressed database block codec %d", codec);
+  }
+
+  read_ += raw_size;
+  setg(buffer_.data(), buffer_.data(), buffer_.data() + buffer_.size());
+  return true;
+}
+
+}  // namespace odb
@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace odb {
+
+//
+// Block compressed container for .odb files.
+//
+// The file starts with the "ODBZ" magic, the container version and the
+// block size, followed by the dbOStream data split into blocks that are
+// compressed independently with a built-in LZ77 codec.  Every block has a
+// header with its raw size, stored size and codec; a block with a zero raw
+// size ends the file.  Blocks that don't compress are stored as is.
+//
+class dbCompressedOStreamBuf : public std::streambuf
+{
+ public:
+  explicit dbCompressedOStreamBuf(std::ostream& sink);
+
+  // Write the buffered data and the end marker.
+  void finish();
+
+ protected:
+  int_type overflow(int_type ch) override;
+  pos_type seekoff(off_type off,
+                   std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override;
+
+ private:
+  void writeBlock();
+
+  std::ostream& sink_;
+  std::vector<char> buffer_;
+  std::vector<char> compressed_;
+  std::vector<int> hash_table_;
+  uint64_t written_ = 0;  // uncompressed bytes in previous blocks
+};
+
+class dbCompressedIStreamBuf : public std::streambuf
+{
+ public:
+  explicit dbCompressedIStreamBuf(std::istream& source);
+
+  // True if the stream starts with a compressed container.
+  static bool isCompressed(std::istream& source);
+
+ protected:
+  int_type underflow() override;
+  pos_type seekoff(off_type off,
+                   std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override;
+
+ private:
+  bool readBlock();
+
+  std::istream& source_;
+  std::vector<char> buffer_;
+  std::vector<char> compressed_;
+  uint64_t read_ = 0;  // uncompressed bytes in previous blocks
+  bool done_ = false;
+};
+
+// Exposed for testing.
+void dbCompressBlock(const char* src,
+                     size_t size,
+                     std::vector<int>& hash_table,
+                     std::vector<char>& dst);
+// Returns false if src is not a valid block of raw_size bytes.
+bool dbDecompressBlock(const char* src,
+                       size_t size,
+                       size_t raw_size,
+                       std::vector<char>& dst);
+
+}  // namespace odb
@@ -43,6 +43,7 @@
 #include "dbCCSeg.h"
 #include "dbCapNode.h"
 #include "dbChip.h"
+#include "dbCompressedStream.h"
 #include "dbITerm.h"
 #include "dbJournal.h"
 #include "dbLib.h"
@@ -505,15 +506,35 @@ dbTech* dbDatabase::getTech()
 void dbDatabase::read(std::istream& file)
 {
   _dbDatabase* db = (_dbDatabase*) this;
+
+  if (dbCompressedIStreamBuf::isCompressed(file)) {
+    dbCompressedIStreamBuf buffer(file);
+    std::istream compressed_file(&buffer);
+    compressed_file.exceptions(file.exceptions() | std::ios::badbit);
+    dbIStream stream(db, compressed_file);
+    stream >> *db;
+    return;
+  }
+
   dbIStream stream(db, file);
   stream >> *db;
 }
 
-void dbDatabase::write(std::ostream& file)
+void dbDatabase::write(std::ostream& file, const bool compress)
 {
   _dbDatabase* db = (_dbDatabase*) this;
-  dbOStream stream(db, file);
-  stream << *db;
+
+  if (compress) {
+    dbCompressedOStreamBuf buffer(file);
+    std::ostream compressed_file(&buffer);
+    compressed_file.exceptions(file.exceptions() | std::ios::badbit);
+    dbOStream stream(db, compressed_file);
+    stream << *db;
+    buffer.finish();
+  } else {
+    dbOStream stream(db, file);
+    stream << *db;
+  }
   file.flush();
 }
 
@@ -115,6 +115,9 @@ tmg_conn::tmg_conn(utl::Logger* logger) : logger_(logger)
   _first_for_clear = nullptr;
   _preserveSWire = false;
   _swireNetCnt = 0;
+  _encoder = &_wire_encoder;
+  _defer_wire_end = false;
+  _wire_encoded = false;
 }
 
 int tmg_conn::ptDist(const int fr, const int to) const
@@ -1419,6 +1422,62 @@ void tmg_conn::analyzeNet(dbNet* net)
   net->setWireOrdered(true);
 }
 
+bool tmg_conn::orderNet(dbNet* net, tmg_conn_order& order)
+{
+  order.net = net;
+  loadNet(net);
+  if (net->getWire()) {
+    loadWire(net->getWire());
+  }
+  if (_ptV.empty()) {
+    order.ignored = true;
+    return true;
+  }
+  findConnections();
+  order.has_swire = _hasSWire;
+  const bool noConvert = _hasSWire && _preserveSWire;
+  if (!noConvert && !net->getWire()) {
+    // dbWire::create is not thread safe
+    return false;
+  }
+  relocateShorts();
+  order.encoder = std::make_unique<dbWireEncoder>();
+  _encoder = order.encoder.get();
+  _defer_wire_end = true;
+  _wire_encoded = false;
+  treeReorder(noConvert);
+  _encoder = &_wire_encoder;
+  _defer_wire_end = false;
+  if (!_wire_encoded) {
+    order.encoder.reset();
+  }
+  order.connected = _connected;
+  return true;
+}
+
+void tmg_conn::commitOrder(tmg_conn_order& order)
+{
+  dbNet* net = order.net;
+  if (order.ignored) {
+    net->setDisconnected(false);
+    net->setWireOrdered(false);
+    return;
+  }
+  if (order.has_swire) {
+    if (_preserveSWire) {
+      net->setDoNotTouch(true);
+      _swireNetCnt++;
+    } else {
+      net->destroySWires();
+    }
+  }
+  if (order.encoder) {
+    order.encoder->end();
+  }
+  net->setDisconnected(!order.connected);
+  net->setWireOrdered(true);
+}
+
 bool tmg_conn::checkConnected()
 {
   for (int j = 0; j < _termN; j++) {
@@ -1522,7 +1581,7 @@ void tmg_conn::treeReorder(const bool no_convert)
     if (!_newWire) {
       _newWire = dbWire::create(_net);
     }
-    _encoder.begin(_newWire);
+    _encoder->begin(_newWire);
     for (int j = 0; j < _ptV.size(); j++) {
       _ptV[j]._dbwire_id = -1;
     }
@@ -1643,7 +1702,11 @@ void tmg_conn::treeReorder(const bool no_convert)
 
   checkVisited();
   if (!no_convert) {
-    _encoder.end();
+    if (_defer_wire_end) {
+      _wire_encoded = true;
+    } else {
+      _encoder->end();
+    }
   }
 }
 
@@ -1677,9 +1740,9 @@ int tmg_conn::addPoint(const int ipt, const tmg_rc* rc)
   const tmg_rcpt* p = &_ptV[ipt];
   const int ext = getExtension(ipt, rc);
   if (ext == rc->_default_ext) {
-    wire_id = _encoder.addPoint(p->_x, p->_y);
+    wire_id = _encoder->addPoint(p->_x, p->_y);
   } else {
-    wire_id = _encoder.addPoint(p->_x, p->_y, ext);
+    wire_id = _encoder->addPoint(p->_x, p->_y, ext);
   }
   return wire_id;
 }
@@ -1690,9 +1753,9 @@ int tmg_conn::addPoint(const int ifr, const int ipt, const tmg_rc* rc)
   const tmg_rcpt* p = &_ptV[ipt];
   const int ext = getExtension(ipt, rc);
   if (ext == rc->_default_ext) {
-    wire_id = _encoder.addPoint(p->_x, p->_y);
+    wire_id = _encoder->addPoint(p->_x, p->_y);
   } else {
-    wire_id = _encoder.addPoint(p->_x, p->_y, ext);
+    wire_id = _encoder->addPoint(p->_x, p->_y, ext);
   }
   return wire_id;
 }
@@ -1705,7 +1768,7 @@ int tmg_conn::addPointIfExt(const int ipt, const tmg_rc* rc)
   const tmg_rcpt* p = &_ptV[ipt];
   const int ext = getExtension(ipt, rc);
   if (ext != rc->_default_ext) {
-    wire_id = _encoder.addPoint(p->_x, p->_y, ext);
+    wire_id = _encoder->addPoint(p->_x, p->_y, ext);
   }
   return wire_id;
 }
@@ -1755,22 +1818,22 @@ void tmg_conn::addToWire(const int fr,
     if (_last_id >= 0) {
       // term feedthru
       if (_path_rule) {
-        _encoder.newPathShort(
+        _encoder->newPathShort(
             _last_id, _ptV[fr]._layer, dbWireType::ROUTED, lyr_rule);
       } else {
-        _encoder.newPathShort(_last_id, _ptV[fr]._layer, dbWireType::ROUTED);
+        _encoder->newPathShort(_last_id, _ptV[fr]._layer, dbWireType::ROUTED);
       }
     } else {
       if (_path_rule) {
-        _encoder.newPath(_ptV[fr]._layer, dbWireType::ROUTED, lyr_rule);
+        _encoder->newPath(_ptV[fr]._layer, dbWireType::ROUTED, lyr_rule);
       } else {
-        _encoder.newPath(_ptV[fr]._layer, dbWireType::ROUTED);
+        _encoder->newPath(_ptV[fr]._layer, dbWireType::ROUTED);
       }
     }
     if (!rc->_shape.isVia()) {
       fr_id = addPoint(fr, rc);
     } else {
-      fr_id = _encoder.addPoint(xfr, yfr);
+      fr_id = _encoder->addPoint(xfr, yfr);
     }
     _ptV[fr]._dbwire_id = fr_id;
     if (_ptV[fr]._tindex >= 0) {
@@ -1779,33 +1842,33 @@ void tmg_conn::addToWire(const int fr,
         x->_first_pt = &_ptV[fr];
       }
       if (x->_iterm) {
-        _encoder.addITerm(x->_iterm);
+        _encoder->addITerm(x->_iterm);
       } else {
-        _encoder.addBTerm(x->_bterm);
+        _encoder->addBTerm(x->_bterm);
       }
     }
   } else if (fr_id != _last_id) {
     _path_rule = rc->_shape._rule;
     if (rc->_shape.isVia()) {
       if (_path_rule) {
-        _encoder.newPath(fr_id, lyr_rule);
+        _encoder->newPath(fr_id, lyr_rule);
       } else {
-        _encoder.newPath(fr_id);
+        _encoder->newPath(fr_id);
       }
     } else {
       _firstSegmentAfterVia = 0;
       const int ext = getExtension(fr, rc);
       if (ext != rc->_default_ext) {
         if (_path_rule) {
-          _encoder.newPathExt(fr_id, ext, lyr_rule);
+          _encoder->newPathExt(fr_id, ext, lyr_rule);
         } else {
-          _encoder.newPathExt(fr_id, ext);
+          _encoder->newPathExt(fr_id, ext);
         }
       } else {
         if (_path_rule) {
-          _encoder.newPath(fr_id, lyr_rule);
+          _encoder->newPath(fr_id, lyr_rule);
         } else {
-          _encoder.newPath(fr_id);
+          _encoder->newPath(fr_id);
         }
       }
     }
@@ -1815,9 +1878,9 @@ void tmg_conn::addToWire(const int fr,
         x->_first_pt = &_ptV[fr];
       }
       if (x->_iterm) {
-        _encoder.addITerm(x->_iterm);
+        _encoder->addITerm(x->_iterm);
       } else {
-        _encoder.addBTerm(x->_bterm);
+        _encoder->addBTerm(x->_bterm);
       }
     }
   } else if (_path_rule != rc->_shape._rule) {
@@ -1826,24 +1889,24 @@ void tmg_conn::addToWire(const int fr,
     _path_rule = rc->_shape._rule;
     if (rc->_shape.isVia()) {
       if (_path_rule) {
-        _encoder.newPath(fr_id, lyr_rule);
+        _encoder->newPath(fr_id, lyr_rule);
       } else {
-        _encoder.newPath(fr_id);
+        _encoder->newPath(fr_id);
       }
     } else {
       _firstSegmentAfterVia = 0;
       const int ext = getExtension(fr, rc);
       if (ext != rc->_default_ext) {
         if (_path_rule) {
-          _encoder.newPathExt(fr_id, ext, lyr_rule);
+          _encoder->newPathExt(fr_id, ext, lyr_rule);
         } else {
-          _encoder.newPathExt(fr_id, ext);
+          _encoder->newPathExt(fr_id, ext);
         }
       } else {
         if (_path_rule) {
-          _encoder.newPath(fr_id, lyr_rule);
+          _encoder->newPath(fr_id, lyr_rule);
         } else {
-          _encoder.newPath(fr_id);
+          _encoder->newPath(fr_id);
         }
       }
     }
@@ -1853,9 +1916,9 @@ void tmg_conn::addToWire(const int fr,
         x->_first_pt = &_ptV[fr];
       }
       if (x->_iterm) {
-        _encoder.addITerm(x->_iterm);
+        _encoder->addITerm(x->_iterm);
       } else {
-        _encoder.addBTerm(x->_bterm);
+        _encoder->addBTerm(x->_bterm);
       }
     }
 
@@ -1875,9 +1938,9 @@ void tmg_conn::addToWire(const int fr,
     }
     to_id = addPoint(fr, to, rc);
   } else if (rc->_shape.getTechVia()) {
-    to_id = _encoder.addTechVia(rc->_shape.getTechVia());
+    to_id = _encoder->addTechVia(rc->_shape.getTechVia());
   } else if (rc->_shape.getVia()) {
-    to_id = _encoder.addVia(rc->_shape.getVia());
+    to_id = _encoder->addVia(rc->_shape.getVia());
   } else {
     logger_->error(ODB, 18, "error in addToWire");
   }
@@ -1898,9 +1961,9 @@ void tmg_conn::addToWire(const int fr,
       x->_first_pt = &_ptV[to];
     }
     if (x->_iterm) {
-      _encoder.addITerm(x->_iterm);
+      _encoder->addITerm(x->_iterm);
     } else {
-      _encoder.addBTerm(x->_bterm);
+      _encoder->addBTerm(x->_bterm);
     }
   }
 
@@ -114,6 +114,18 @@ struct tmg_rcshort
   bool _skip;
 };
 
+// Wire ordering of one net computed without writing to the db so that
+// nets can be ordered concurrently and committed in net order.
+struct tmg_conn_order
+{
+  dbNet* net = nullptr;
+  bool ignored = false;  // no wire or swire shapes
+  bool has_swire = false;
+  bool connected = false;
+  // New wire contents, written to the net's dbWire on commit.
+  std::unique_ptr<dbWireEncoder> encoder;
+};
+
 class tmg_conn_search;
 class tmg_conn_graph;
 struct tmg_connect_shape
@@ -146,7 +158,10 @@ class tmg_conn
   bool _preserveSWire;
   int _swireNetCnt;
   bool _connected;
-  dbWireEncoder _encoder;
+  dbWireEncoder _wire_encoder;
+  dbWireEncoder* _encoder;
+  bool _defer_wire_end;
+  bool _wire_encoded;
   dbWire* _newWire;
   dbTechNonDefaultRule* _net_rule;
   dbTechNonDefaultRule* _path_rule;
@@ -169,6 +184,10 @@ class tmg_conn
  public:
   tmg_conn(utl::Logger* logger);
   void analyzeNet(dbNet* net);
+  // Returns false if the net needs a new dbWire and must be analyzed
+  // with analyzeNet instead.
+  bool orderNet(dbNet* net, tmg_conn_order& order);
+  void commitOrder(tmg_conn_order& order);
   void loadNet(dbNet* net);
   void loadWire(dbWire* wire);
   void loadSWire(dbNet* net);
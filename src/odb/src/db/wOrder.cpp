@@ -32,23 +32,63 @@
 
 #include "odb/wOrder.h"
 
+#include <omp.h>
+
+#include <algorithm>
+#include <vector>
+
 #include "odb/db.h"
 #include "tmg_conn.h"
 
 namespace odb {
 
 static tmg_conn* conn = nullptr;
+// Per thread connectivity scratch, reused across calls.
+static std::vector<tmg_conn*> thread_conns;
 
-void orderWires(utl::Logger* logger, dbBlock* block)
+// Ordering a net only reads the db until its wire is rewritten, so chunks
+// of nets are ordered concurrently and the new wires are committed
+// serially in net order, giving the same db as ordering on one thread.
+void orderWires(utl::Logger* logger, dbBlock* block, const int thread_count)
 {
   if (conn == nullptr) {
     conn = new tmg_conn(logger);
   }
+  std::vector<dbNet*> nets;
   for (auto net : block->getNets()) {
     if (net->getSigType().isSupply() || net->isWireOrdered()) {
       continue;
     }
-    conn->analyzeNet(net);
+    nets.push_back(net);
+  }
+  if (thread_count <= 1) {
+    for (dbNet* net : nets) {
+      conn->analyzeNet(net);
+    }
+    return;
+  }
+
+  while (thread_conns.size() < static_cast<size_t>(thread_count)) {
+    thread_conns.push_back(new tmg_conn(logger));
+  }
+  const int net_count = nets.size();
+  const int chunk_size = 256 * thread_count;
+  for (int start = 0; start < net_count; start += chunk_size) {
+    const int end = std::min(start + chunk_size, net_count);
+    std::vector<tmg_conn_order> orders(end - start);
+    std::vector<char> ordered(end - start, false);
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 16)
+    for (int i = start; i < end; i++) {
+      tmg_conn* thread_conn = thread_conns[omp_get_thread_num()];
+      ordered[i - start] = thread_conn->orderNet(nets[i], orders[i - start]);
+    }
+    for (int i = start; i < end; i++) {
+      if (ordered[i - start]) {
+        conn->commitOrder(orders[i - start]);
+      } else {
+        conn->analyzeNet(nets[i]);
+      }
+    }
   }
 }
 
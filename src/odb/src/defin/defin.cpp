@@ -92,6 +92,11 @@ void defin::setAssemblyMode()
   _reader->setAssemblyMode();
 }
 
+void defin::disablePrefetch()
+{
+  _reader->disablePrefetch();
+}
+
 void defin::useBlockName(const char* name)
 {
   _reader->useBlockName(name);
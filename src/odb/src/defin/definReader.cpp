@@ -32,11 +32,21 @@
 
 #include "definReader.h"
 
+#include <zlib.h>
+
+#include <algorithm>
 #include <cctype>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "definBlockage.h"
 #include "definComponent.h"
@@ -284,6 +294,11 @@ void definReader::continueOnErrors()
   _continue_on_errors = true;
 }
 
+void definReader::disablePrefetch()
+{
+  _prefetch = false;
+}
+
 void definReader::replaceWires()
 {
   _netR->replaceWires();
@@ -2037,6 +2052,171 @@ static inline bool hasSuffix(const std::string& str, const std::string& suffix)
          && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
 
+namespace {
+
+// Reads the DEF file on a separate thread a few chunks ahead of the parser
+// so that file io and gzip decompression overlap with parsing and building
+// the database.  The parser gets the reader in place of its FILE*.
+class DefPrefetchReader
+{
+ public:
+  using ReadFunc = std::function<size_t(char* buffer, size_t size)>;
+
+  explicit DefPrefetchReader(ReadFunc read_func);
+  ~DefPrefetchReader();
+
+  // DEFI_READ_FUNCTION
+  static size_t read(FILE* file, char* buffer, size_t size);
+
+ private:
+  void prefetch();
+  size_t read(char* buffer, size_t size);
+
+  static constexpr size_t kChunkSize = 1 << 20;
+  static constexpr size_t kMaxChunks = 8;
+
+  ReadFunc read_func_;
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::deque<std::vector<char>> chunks_;
+  bool eof_ = false;
+  bool stop_ = false;
+  std::vector<char> current_;
+  size_t current_pos_ = 0;
+  std::thread thread_;
+};
+
+DefPrefetchReader::DefPrefetchReader(ReadFunc read_func)
+    : read_func_(std::move(read_func)),
+      thread_(&DefPrefetchReader::prefetch, this)
+{
+}
+
+DefPrefetchReader::~DefPrefetchReader()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  changed_.notify_all();
+  thread_.join();
+}
+
+size_t DefPrefetchReader::read(FILE* file, char* buffer, size_t size)
+{
+  return reinterpret_cast<DefPrefetchReader*>(file)->read(buffer, size);
+}
+
+void DefPrefetchReader::prefetch()
+{
+  bool eof = false;
+  while (!eof) {
+    std::vector<char> chunk(kChunkSize);
+    size_t size = 0;
+    while (size < chunk.size()) {
+      const size_t count = read_func_(chunk.data() + size, chunk.size() - size);
+      if (count == 0) {
+        break;
+      }
+      size += count;
+    }
+    chunk.resize(size);
+    eof = size < kChunkSize;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock,
+                  [this] { return stop_ || chunks_.size() < kMaxChunks; });
+    if (stop_) {
+      return;
+    }
+    if (size > 0) {
+      chunks_.push_back(std::move(chunk));
+    }
+    eof_ = eof;
+    lock.unlock();
+    changed_.notify_all();
+  }
+}
+
+size_t DefPrefetchReader::read(char* buffer, const size_t size)
+{
+  if (current_pos_ == current_.size()) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      changed_.wait(lock, [this] { return eof_ || !chunks_.empty(); });
+      if (chunks_.empty()) {
+        return 0;
+      }
+      current_ = std::move(chunks_.front());
+      chunks_.pop_front();
+      current_pos_ = 0;
+    }
+    changed_.notify_all();
+  }
+
+  const size_t count = std::min(size, current_.size() - current_pos_);
+  std::memcpy(buffer, current_.data() + current_pos_, count);
+  current_pos_ += count;
+  return count;
+}
+
+// Calls the read function on the parsing thread.
+class DefDirectReader
+{
+ public:
+  explicit DefDirectReader(DefPrefetchReader::ReadFunc read_func)
+      : read_func_(std::move(read_func))
+  {
+  }
+
+  // DEFI_READ_FUNCTION
+  static size_t read(FILE* file, char* buffer, size_t size)
+  {
+    return reinterpret_cast<DefDirectReader*>(file)->read_func_(buffer, size);
+  }
+
+ private:
+  DefPrefetchReader::ReadFunc read_func_;
+};
+
+// Points the parser's read hook at a reader only while in scope, so an
+// error thrown from a callback can't leave it pointing at a dead reader.
+class DefReadFunctionGuard
+{
+ public:
+  explicit DefReadFunctionGuard(DEFI_READ_FUNCTION read_func)
+  {
+    defrSetReadFunction(read_func);
+  }
+  ~DefReadFunctionGuard() { defrUnsetReadFunction(); }
+  DefReadFunctionGuard(const DefReadFunctionGuard&) = delete;
+  DefReadFunctionGuard& operator=(const DefReadFunctionGuard&) = delete;
+};
+
+int readDef(const DefPrefetchReader::ReadFunc& read_func,
+            const char* file,
+            definReader* reader,
+            const bool prefetch)
+{
+  if (!prefetch) {
+    DefDirectReader direct_reader(read_func);
+    const DefReadFunctionGuard guard(DefDirectReader::read);
+    return defrRead(reinterpret_cast<FILE*>(&direct_reader),
+                    file,
+                    (defiUserData) reader,
+                    /* case sensitive */ 1);
+  }
+
+  DefPrefetchReader prefetch_reader(read_func);
+  const DefReadFunctionGuard guard(DefPrefetchReader::read);
+  return defrRead(reinterpret_cast<FILE*>(&prefetch_reader),
+                  file,
+                  (defiUserData) reader,
+                  /* case sensitive */ 1);
+}
+
+}  // namespace
+
 bool definReader::createBlock(const char* file)
 {
   defrInit();
@@ -2103,18 +2283,28 @@ bool definReader::createBlock(const char* file)
       _logger->warn(utl::ODB, 148, "error: Cannot open DEF file {}", file);
       return false;
     }
-    res = defrRead(f, file, (defiUserData) this, /* case sensitive */ 1);
+    res = readDef(
+        [f](char* buffer, size_t size) { return fread(buffer, 1, size, f); },
+        file,
+        this,
+        _prefetch);
     fclose(f);
   } else {
-    defrSetGZipReadFunction();
     defGZFile f = defrGZipOpen(file, "r");
     if (f == nullptr) {
       _logger->warn(
           utl::ODB, 271, "error: Cannot open zipped DEF file {}", file);
       return false;
     }
-    res = defrReadGZip(f, file, (defiUserData) this);
-    defGZipClose(f);
+    res = readDef(
+        [f](char* buffer, size_t size) -> size_t {
+          const int count = gzread((gzFile) f, buffer, size);
+          return count > 0 ? count : 0;
+        },
+        file,
+        this,
+        _prefetch);
+    defrGZipClose(f);
   }
 
   if (res != 0 || errors() != 0) {
@@ -2152,7 +2342,12 @@ bool definReader::replaceWires(const char* file)
 
   defrSetAddPathToNet();
 
-  int res = defrRead(f, file, (defiUserData) this, /* case sensitive */ 1);
+  int res = readDef(
+      [f](char* buffer, size_t size) { return fread(buffer, 1, size, f); },
+      file,
+      this,
+      _prefetch);
+  fclose(f);
   if (res != 0) {
     if (!_continue_on_errors) {
       _logger->error(utl::ODB, 422, "DEF parser returns an error!");
@@ -82,6 +82,7 @@ class definReader : public definBase
   std::vector<definBase*> _interfaces;
   bool _update;
   bool _continue_on_errors;
+  bool _prefetch = true;
   std::string _block_name;
   std::string version_;
   char hier_delimeter_;
@@ -261,6 +262,7 @@ class definReader : public definBase
   void useBlockName(const char* name);
   void namesAreDBIDs();
   void setAssemblyMode();
+  void disablePrefetch();
   void error(std::string_view msg);
 
   dbChip* createChip(std::vector<dbLib*>& search_libs,
@@ -180,7 +180,7 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
   return db;
 }
 
-int write_db(odb::dbDatabase* db, const char* db_path)
+int write_db(odb::dbDatabase* db, const char* db_path, bool compress)
 {
   std::ofstream fp(db_path, std::ios::binary);
   if (!fp) {
@@ -189,7 +189,7 @@ int write_db(odb::dbDatabase* db, const char* db_path)
     fprintf(stderr, "Errno: %d\n", errno);
     return errno;
   }
-  db->write(fp);
+  db->write(fp, compress);
   return 1;
 }
 
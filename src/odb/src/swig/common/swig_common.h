@@ -50,7 +50,7 @@ int write_def(odb::dbBlock* block,
 
 odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path);
 
-int write_db(odb::dbDatabase* db, const char* db_path);
+int write_db(odb::dbDatabase* db, const char* db_path, bool compress = false);
 
 int writeEco(odb::dbBlock* block, const char* filename);
 
@@ -189,6 +189,11 @@ void Ath__parser::openFile(const char* name)
   } else {  //
     _inFP = ATH__openFile(_inputFile, "r", _logger);
   }
+  if (_inFP != nullptr) {
+    // Parsed files such as SPEF can be very large; read them in big blocks
+    // rather than the default stdio buffer size.
+    setvbuf(_inFP, nullptr, _IOFBF, 1 << 20);
+  }
 }
 
 void Ath__parser::setInputFP(FILE* fp)
@@ -0,0 +1,112 @@
+#define BOOST_TEST_MODULE TestCompressedDb
+#include <boost/test/included/unit_test.hpp>
+#include <sstream>
+#include <stdexcept>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+static dbDatabase* createDesign()
+{
+  dbDatabase* db = createSimpleDB();
+  dbBlock* block = db->getChip()->getBlock();
+  dbMaster* and2 = db->findMaster("and2");
+  for (int i = 0; i < 1000; i++) {
+    dbInst* inst = dbInst::create(block, and2, fmt::format("i{}", i).c_str());
+    inst->setLocation(i * 100, i * 10);
+    dbNet::create(block, fmt::format("n{}", i).c_str());
+  }
+  return db;
+}
+
+static std::string writeDb(dbDatabase* db, const bool compress)
+{
+  std::stringstream stream;
+  stream.exceptions(std::ios::failbit | std::ios::badbit);
+  db->write(stream, compress);
+  return stream.str();
+}
+
+static dbDatabase* readDb(const std::string& data)
+{
+  std::istringstream stream(data);
+  stream.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+  dbDatabase* db = dbDatabase::create();
+  db->read(stream);
+  return db;
+}
+
+BOOST_AUTO_TEST_CASE(test_round_trip)
+{
+  dbDatabase* db = createDesign();
+  const std::string plain = writeDb(db, false);
+  const std::string compressed = writeDb(db, true);
+  dbDatabase::destroy(db);
+
+  BOOST_TEST(compressed.size() < plain.size());
+
+  for (const std::string& data : {plain, compressed}) {
+    dbDatabase* db2 = readDb(data);
+    dbBlock* block = db2->getChip()->getBlock();
+    BOOST_TEST(block->getInsts().size() == 1000);
+    BOOST_TEST(block->getNets().size() == 1000);
+    dbInst* inst = block->findInst("i999");
+    BOOST_TEST(inst != nullptr);
+    BOOST_TEST(inst->getLocation() == Point(99900, 9990));
+    BOOST_TEST(writeDb(db2, false) == plain);
+    dbDatabase::destroy(db2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_corrupt_block)
+{
+  dbDatabase* db = createDesign();
+  std::string compressed = writeDb(db, true);
+  dbDatabase::destroy(db);
+
+  // Damage the payload of the first block past its header.
+  for (size_t i = 40; i < 80; i++) {
+    compressed[i] = (char) 0xff;
+  }
+  BOOST_CHECK_THROW(readDb(compressed), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_truncated_file)
+{
+  dbDatabase* db = createDesign();
+  const std::string compressed = writeDb(db, true);
+  dbDatabase::destroy(db);
+
+  // Cut inside the file header, a block header and a block payload.  The
+  // source stream has no exceptions enabled so the reader must notice.
+  for (const size_t size : {size_t(6), size_t(14), compressed.size() / 2}) {
+    std::istringstream stream(compressed.substr(0, size));
+    dbDatabase* db2 = dbDatabase::create();
+    BOOST_CHECK_THROW(db2->read(stream), std::runtime_error);
+    dbDatabase::destroy(db2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_magic_prefix)
+{
+  // Only the full "ODBZ" magic selects the compressed reader, so this is
+  // rejected as a plain database.
+  std::istringstream stream(std::string("ODBX") + std::string(64, '\0'));
+  dbDatabase* db = dbDatabase::create();
+  BOOST_CHECK_EXCEPTION(
+      db->read(stream), std::runtime_error, [](const std::runtime_error& e) {
+        return std::string(e.what()).find("not an OpenDB Database")
+               != std::string::npos;
+      });
+  dbDatabase::destroy(db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
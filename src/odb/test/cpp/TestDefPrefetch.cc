@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "utl/Logger.h"
+
+namespace odb {
+
+template <class T>
+using OdbUniquePtr = std::unique_ptr<T, void (*)(T*)>;
+
+static const char* kGcdDef = "data/gcd/gcd_nangate45_route.def";
+
+class DefPrefetch : public ::testing::Test
+{
+ protected:
+  OdbUniquePtr<dbDatabase> makeDb()
+  {
+    OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+    lefin lef_reader(db.get(), &logger_, /*ignore_non_routing_layers=*/false);
+    lib_ = lef_reader.createTechAndLib(
+        "Nangate45",
+        "Nangate45",
+        "data/Nangate45/NangateOpenCellLibrary.mod.lef");
+    return db;
+  }
+
+  dbChip* readDef(dbDatabase* db, const char* path, const bool prefetch)
+  {
+    defin def_reader(db, &logger_);
+    if (!prefetch) {
+      def_reader.disablePrefetch();
+    }
+    std::vector<dbLib*> search_libs{lib_};
+    return def_reader.createChip(search_libs, path, lib_->getTech());
+  }
+
+  utl::Logger logger_;
+  dbLib* lib_ = nullptr;
+};
+
+TEST_F(DefPrefetch, MatchesDirectRead)
+{
+  OdbUniquePtr<dbDatabase> prefetch_db = makeDb();
+  ASSERT_NE(readDef(prefetch_db.get(), kGcdDef, true), nullptr);
+
+  OdbUniquePtr<dbDatabase> direct_db = makeDb();
+  ASSERT_NE(readDef(direct_db.get(), kGcdDef, false), nullptr);
+
+  FILE* report = std::tmpfile();
+  ASSERT_NE(report, nullptr);
+  EXPECT_FALSE(dbDatabase::diff(prefetch_db.get(), direct_db.get(), report, 2));
+  std::fclose(report);
+}
+
+TEST_F(DefPrefetch, ErrorResetsReadFunction)
+{
+  // A via with a single shape makes the via callback raise ODB-0299 while
+  // the prefetching reader is installed.
+  const std::filesystem::path bad_def
+      = std::filesystem::temp_directory_path() / "def_prefetch_bad_via.def";
+  {
+    std::ofstream out(bad_def);
+    out << "VERSION 5.8 ;\n"
+           "DIVIDERCHAR \"/\" ;\n"
+           "BUSBITCHARS \"[]\" ;\n"
+           "DESIGN bad_via ;\n"
+           "UNITS DISTANCE MICRONS 2000 ;\n"
+           "DIEAREA ( 0 0 ) ( 10000 10000 ) ;\n"
+           "VIAS 1 ;\n"
+           "- bad_via + RECT metal1 ( -100 -100 ) ( 100 100 ) ;\n"
+           "END VIAS\n"
+           "END DESIGN\n";
+  }
+
+  OdbUniquePtr<dbDatabase> bad_db = makeDb();
+  EXPECT_THROW(readDef(bad_db.get(), bad_def.c_str(), true),
+               std::runtime_error);
+  std::filesystem::remove(bad_def);
+
+  // The next read must not see the destroyed reader of the failed one.
+  OdbUniquePtr<dbDatabase> db = makeDb();
+  EXPECT_NE(readDef(db.get(), kGcdDef, true), nullptr);
+}
+
+}  // namespace odb
@@ -0,0 +1,81 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "odb/wOrder.h"
+#include "utl/Logger.h"
+
+namespace odb {
+
+template <class T>
+using OdbUniquePtr = std::unique_ptr<T, void (*)(T*)>;
+
+// orderWires keeps its connectivity scratch, and the logger it was first
+// given, across calls.
+static utl::Logger* orderLogger()
+{
+  static utl::Logger logger;
+  return &logger;
+}
+
+static OdbUniquePtr<dbDatabase> readRoutedGcd()
+{
+  OdbUniquePtr<dbDatabase> db(dbDatabase::create(), &dbDatabase::destroy);
+  utl::Logger* logger = orderLogger();
+  lefin lef_reader(db.get(), logger, /*ignore_non_routing_layers=*/false);
+  dbLib* lib = lef_reader.createTechAndLib(
+      "Nangate45", "Nangate45", "data/Nangate45/NangateOpenCellLibrary.mod.lef");
+  defin def_reader(db.get(), logger);
+  std::vector<dbLib*> search_libs{lib};
+  def_reader.createChip(
+      search_libs, "data/gcd/gcd_nangate45_route.def", lib->getTech());
+  return db;
+}
+
+static void expectSameWires(dbBlock* block1, dbBlock* block2)
+{
+  for (dbNet* net1 : block1->getNets()) {
+    dbNet* net2 = block2->findNet(net1->getConstName());
+    ASSERT_NE(net2, nullptr);
+    EXPECT_EQ(net1->isWireOrdered(), net2->isWireOrdered());
+    EXPECT_EQ(net1->isDisconnected(), net2->isDisconnected());
+    dbWire* wire1 = net1->getWire();
+    dbWire* wire2 = net2->getWire();
+    ASSERT_EQ(wire1 == nullptr, wire2 == nullptr) << net1->getName();
+    if (wire1 == nullptr) {
+      continue;
+    }
+    ASSERT_EQ(wire1->length(), wire2->length()) << net1->getName();
+    for (int i = 0; i < wire1->length(); i++) {
+      EXPECT_EQ(wire1->getOpcode(i), wire2->getOpcode(i)) << net1->getName();
+      EXPECT_EQ(wire1->getData(i), wire2->getData(i)) << net1->getName();
+    }
+  }
+}
+
+TEST(OrderWires, ThreadCountDoesNotChangeWires)
+{
+  OdbUniquePtr<dbDatabase> serial_db = readRoutedGcd();
+  dbBlock* serial_block = serial_db->getChip()->getBlock();
+  orderWires(orderLogger(), serial_block, 1);
+
+  int ordered_count = 0;
+  for (dbNet* net : serial_block->getNets()) {
+    if (net->isWireOrdered()) {
+      ordered_count++;
+    }
+  }
+  EXPECT_GT(ordered_count, 0);
+
+  for (const int thread_count : {2, 4}) {
+    OdbUniquePtr<dbDatabase> db = readRoutedGcd();
+    orderWires(orderLogger(), db->getChip()->getBlock(), thread_count);
+    expectSameWires(serial_block, db->getChip()->getBlock());
+  }
+}
+
+}  // namespace odb
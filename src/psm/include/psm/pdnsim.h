@@ -107,7 +107,8 @@ class PDNSim : public odb::dbBlockCallBackObj
                         bool enable_em,
                         const std::string& em_file,
                         const std::string& error_file,
-                        const std::string& voltage_source_file);
+                        const std::string& voltage_source_file,
+                        bool use_iterative_solver = false);
   void writeSpiceNetwork(odb::dbNet* net,
                          sta::Corner* corner,
                          GeneratedSourceType source_type,
@@ -32,7 +32,6 @@
 
 #include "ir_solver.h"
 
-#include <Eigen/SparseLU>
 #include <fstream>
 #include <list>
 #include <queue>
@@ -858,7 +857,8 @@ void IRSolver::addSourcesToMatrixAndVoltages(
 
 void IRSolver::solve(sta::Corner* corner,
                      GeneratedSourceType source_type,
-                     const std::string& source_file)
+                     const std::string& source_file,
+                     bool use_iterative_solver)
 {
   const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
 
@@ -918,8 +918,8 @@ void IRSolver::solve(sta::Corner* corner,
   debugPrint(logger_, utl::PSM, "stats", 1, "Nodes in matrix: {}", num_nodes);
 
   // create sparse matrix and vector
-  Eigen::SparseMatrix<Connection::Conductance> G(num_nodes, num_nodes);
-  Eigen::VectorXd J(num_nodes);
+  ConductanceMatrix G(num_nodes, num_nodes);
+  Eigen::VectorXd J = Eigen::VectorXd::Zero(num_nodes);
 
   // Build G and J
   buildCondMatrixAndVoltages(src_voltage == 0.0,
@@ -929,28 +929,120 @@ void IRSolver::solve(sta::Corner* corner,
                              node_index,
                              G,
                              J);
-  addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
 
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
+  Eigen::VectorXd V;
+  if (use_iterative_solver) {
+    V = solveIterative(G, J, src_voltage, src_nodes, node_index);
+  } else {
+    addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
+    G.makeCompressed();
+    V = solveDirect(G, J, node_index);
+  }
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Solving system of equations GV=J complete");
 
-  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(G);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
-    // decomposition failed
-    if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
+  if (logger_->debugCheck(utl::PSM, "dump", 2)) {
+    network_->dumpNodes(node_index);
+    dumpMatrix(G, "G");
+    dumpVector(J, "J");
+    dumpVector(V, "V");
+  }
+  for (const auto& [node, node_idx] : real_node_index) {
+    voltages[node] = V[node_idx];
+  }
+  solution_voltages_[corner] = src_voltage;
+}
+
+bool IRSolver::MatrixSignature::samePattern(const MatrixSignature& other) const
+{
+  return rows == other.rows && cols == other.cols
+         && non_zeros == other.non_zeros && pattern_hash == other.pattern_hash;
+}
+
+bool IRSolver::MatrixSignature::sameValues(const MatrixSignature& other) const
+{
+  return samePattern(other) && value_hash == other.value_hash;
+}
+
+// FNV-1a over the raw index and value arrays. The matrix must be compressed.
+IRSolver::MatrixSignature IRSolver::matrixSignature(
+    const ConductanceMatrix& matrix)
+{
+  auto hash_bytes = [](std::size_t hash, const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++) {
+      hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+  };
+
+  MatrixSignature signature;
+  signature.rows = matrix.rows();
+  signature.cols = matrix.cols();
+  signature.non_zeros = matrix.nonZeros();
+
+  const std::size_t offset_basis = 14695981039346656037ULL;
+  const auto outer_size = matrix.outerSize() + 1;
+  const auto nnz = matrix.nonZeros();
+  std::size_t pattern_hash = offset_basis;
+  pattern_hash = hash_bytes(pattern_hash,
+                            matrix.outerIndexPtr(),
+                            outer_size * sizeof(*matrix.outerIndexPtr()));
+  pattern_hash = hash_bytes(pattern_hash,
+                            matrix.innerIndexPtr(),
+                            nnz * sizeof(*matrix.innerIndexPtr()));
+  signature.pattern_hash = pattern_hash;
+  signature.value_hash = hash_bytes(
+      offset_basis, matrix.valuePtr(), nnz * sizeof(*matrix.valuePtr()));
+  return signature;
+}
+
+Eigen::VectorXd IRSolver::solveDirect(
+    const ConductanceMatrix& G,
+    const Eigen::VectorXd& J,
+    const std::map<Node*, std::size_t>& node_index)
+{
+  const MatrixSignature signature = matrixSignature(G);
+  if (direct_solver_ != nullptr && signature.sameValues(direct_G_)) {
+    debugPrint(
+        logger_, utl::PSM, "solve", 1, "Reusing factorization of the G matrix");
+  } else {
+    if (direct_solver_ != nullptr && signature.samePattern(direct_G_)) {
+      debugPrint(logger_,
+                 utl::PSM,
+                 "solve",
+                 1,
+                 "Refactorizing the G matrix with the existing pattern");
+    } else {
+      debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
+      direct_solver_ = std::make_unique<DirectSolver>();
+      direct_solver_->analyzePattern(G);
+    }
+    direct_G_ = signature;
+    direct_solver_->factorize(G);
+    if (direct_solver_->info() != Eigen::ComputationInfo::Success) {
+      const std::string message = direct_solver_->lastErrorMessage();
+      direct_solver_ = nullptr;
+      direct_G_ = MatrixSignature();
+      // decomposition failed
+      if (logger_->debugCheck(utl::PSM, "dump", 1)) {
+        network_->dumpNodes(node_index);
+        dumpMatrix(G, "G");
+      }
+      logger_->error(utl::PSM,
+                     10,
+                     "LU factorization of the G Matrix failed. SparseLU solver "
+                     "message: {}.",
+                     message);
     }
-    logger_->error(
-        utl::PSM,
-        10,
-        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
   }
 
   debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd V = eigen_solver.solve(J);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+  Eigen::VectorXd V = direct_solver_->solve(J);
+  if (direct_solver_->info() != Eigen::ComputationInfo::Success) {
     // solving failed
     if (logger_->debugCheck(utl::PSM, "dump", 1)) {
       network_->dumpNodes(node_index);
@@ -959,22 +1051,106 @@ void IRSolver::solve(sta::Corner* corner,
     }
     logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
   }
+
+  return V;
+}
+
+Eigen::VectorXd IRSolver::solveIterative(
+    const ConductanceMatrix& G,
+    const Eigen::VectorXd& J,
+    Voltage src_voltage,
+    const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
+    const std::map<Node*, std::size_t>& node_index)
+{
+  // Nodes attached to a source have a known voltage, removing them from the
+  // system leaves the symmetric positive definite matrix of the free nodes
+  // which is solved with a preconditioned conjugate gradient.
+  const std::size_t num_nodes = G.rows();
+  std::vector<bool> fixed(num_nodes, false);
+  for (const auto& src_node : sources) {
+    fixed[node_index.at(src_node.get())] = true;
+    fixed[node_index.at(src_node->getSource())] = true;
+  }
+
+  std::vector<Eigen::Index> reduced_index(num_nodes, -1);
+  Eigen::Index num_free = 0;
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    if (!fixed[i]) {
+      reduced_index[i] = num_free++;
+    }
+  }
+
+  Eigen::VectorXd b(num_free);
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    if (!fixed[i]) {
+      b[reduced_index[i]] = J[i];
+    }
+  }
+
+  std::vector<Eigen::Triplet<Connection::Conductance>> cond_values;
+  cond_values.reserve(G.nonZeros());
+  for (Eigen::Index col = 0; col < G.outerSize(); col++) {
+    for (ConductanceMatrix::InnerIterator itr(G, col); itr; ++itr) {
+      const Eigen::Index row_idx = reduced_index[itr.row()];
+      if (row_idx < 0) {
+        continue;
+      }
+      const Eigen::Index col_idx = reduced_index[itr.col()];
+      if (col_idx < 0) {
+        b[row_idx] -= itr.value() * src_voltage;
+      } else {
+        cond_values.emplace_back(row_idx, col_idx, itr.value());
+      }
+    }
+  }
+  ConductanceMatrix A(num_free, num_free);
+  A.setFromTriplets(cond_values.begin(), cond_values.end());
+  cond_values.clear();
+
+  const MatrixSignature signature = matrixSignature(A);
+  if (iterative_solver_ != nullptr && signature.sameValues(iterative_G_)) {
+    debugPrint(logger_, utl::PSM, "solve", 1, "Reusing the preconditioner");
+  } else {
+    debugPrint(logger_, utl::PSM, "solve", 1, "Computing the preconditioner");
+    iterative_solver_ = std::make_unique<IterativeSolver>();
+    iterative_solver_->setTolerance(iterative_solver_tolerance_);
+    iterative_G_ = signature;
+    iterative_solver_->compute(A);
+    if (iterative_solver_->info() != Eigen::ComputationInfo::Success) {
+      iterative_solver_ = nullptr;
+      iterative_G_ = MatrixSignature();
+      logger_->error(
+          utl::PSM, 94, "Preconditioning of the G matrix failed.");
+    }
+  }
+
   debugPrint(logger_,
              utl::PSM,
              "solve",
              1,
-             "Solving system of equations GV=J complete");
-
-  if (logger_->debugCheck(utl::PSM, "dump", 2)) {
-    network_->dumpNodes(node_index);
-    dumpMatrix(G, "G");
-    dumpVector(J, "J");
-    dumpVector(V, "V");
+             "Solving system of equations GV=J iteratively");
+  const Eigen::VectorXd x = iterative_solver_->solve(b);
+  if (iterative_solver_->info() != Eigen::ComputationInfo::Success) {
+    logger_->error(utl::PSM,
+                   95,
+                   "Iterative solver did not converge after {} iterations "
+                   "(estimated error {}).",
+                   iterative_solver_->iterations(),
+                   iterative_solver_->error());
   }
-  for (const auto& [node, node_idx] : real_node_index) {
-    voltages[node] = V[node_idx];
+  debugPrint(logger_,
+             utl::PSM,
+             "solve",
+             1,
+             "Iterative solver converged in {} iterations (estimated error {})",
+             iterative_solver_->iterations(),
+             iterative_solver_->error());
+
+  Eigen::VectorXd V(num_nodes);
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    V[i] = fixed[i] ? src_voltage : x[reduced_index[i]];
   }
-  solution_voltages_[corner] = src_voltage;
+  return V;
 }
 
 std::map<odb::dbInst*, IRSolver::Power> IRSolver::getInstancePower(
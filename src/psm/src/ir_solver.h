@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/Sparse>
+#include <Eigen/SparseLU>
 #include <boost/geometry.hpp>
 #include <boost/polygon/polygon.hpp>
 #include <map>
@@ -102,7 +104,8 @@ class IRSolver
 
   void solve(sta::Corner* corner,
              GeneratedSourceType source_type,
-             const std::string& source_file);
+             const std::string& source_file,
+             bool use_iterative_solver = false);
 
   void report(sta::Corner* corner) const;
   void reportEM(sta::Corner* corner) const;
@@ -148,6 +151,12 @@ class IRSolver
  private:
   template <typename T>
   using ValueNodeMap = std::map<const Node*, T>;
+  using ConductanceMatrix = Eigen::SparseMatrix<Connection::Conductance>;
+  using DirectSolver = Eigen::SparseLU<ConductanceMatrix>;
+  using IterativeSolver
+      = Eigen::ConjugateGradient<ConductanceMatrix,
+                                 Eigen::Lower | Eigen::Upper,
+                                 Eigen::IncompleteCholesky<double>>;
 
   odb::dbBlock* getBlock() const;
   odb::dbTech* getTech() const;
@@ -212,6 +221,29 @@ class IRSolver
       Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
 
+  Eigen::VectorXd solveDirect(const ConductanceMatrix& G,
+                              const Eigen::VectorXd& J,
+                              const std::map<Node*, std::size_t>& node_index);
+  Eigen::VectorXd solveIterative(
+      const ConductanceMatrix& G,
+      const Eigen::VectorXd& J,
+      Voltage src_voltage,
+      const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
+      const std::map<Node*, std::size_t>& node_index);
+  // Identifies a compressed matrix without keeping a copy of it.
+  struct MatrixSignature
+  {
+    Eigen::Index rows = 0;
+    Eigen::Index cols = 0;
+    Eigen::Index non_zeros = 0;
+    std::size_t pattern_hash = 0;
+    std::size_t value_hash = 0;
+
+    bool samePattern(const MatrixSignature& other) const;
+    bool sameValues(const MatrixSignature& other) const;
+  };
+  static MatrixSignature matrixSignature(const ConductanceMatrix& matrix);
+
   std::string getMetricKey(const std::string& key, sta::Corner* corner) const;
 
   void dumpVector(const Eigen::VectorXd& vector, const std::string& name) const;
@@ -243,6 +275,18 @@ class IRSolver
   std::map<sta::Corner*, ValueNodeMap<Voltage>> voltages_;
   std::map<sta::Corner*, ValueNodeMap<Current>> currents_;
 
+  // G only depends on the grid and the layer resistances, so the last
+  // factorization is kept and reused for every corner and every
+  // analyze_power_grid call that produces the same matrix. The solver is
+  // destroyed by PDNSim whenever the grid changes.
+  // Only a signature of the factorized matrix is kept to detect reuse.
+  MatrixSignature direct_G_;
+  std::unique_ptr<DirectSolver> direct_solver_;
+  MatrixSignature iterative_G_;
+  std::unique_ptr<IterativeSolver> iterative_solver_;
+
+  static constexpr double iterative_solver_tolerance_ = 1e-10;
+
   static constexpr Current spice_file_min_current_ = 1e-18;
 };
 
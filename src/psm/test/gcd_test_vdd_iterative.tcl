@@ -0,0 +1,53 @@
+# Iterative solver against the direct solver golden of gcd_test_vdd.
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+set voltage_file [make_result_file gcd_test_vdd_iterative-voltage.rpt]
+
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $voltage_file -net VDD \
+  -use_iterative_solver
+
+# The voltages are reported to 1e-6 V, so allow one unit in the last place
+# on top of the solver tolerance.
+proc diff_voltage_files { file1 file2 tolerance } {
+  set stream1 [open $file1 r]
+  set stream2 [open $file2 r]
+
+  set line 1
+  set found_diff 0
+  set line1_length [gets $stream1 line1]
+  set line2_length [gets $stream2 line2]
+  while { $line1_length >= 0 && $line2_length >= 0 } {
+    if { $line1 != $line2 } {
+      set fields1 [split $line1 ","]
+      set fields2 [split $line2 ","]
+      if { [lrange $fields1 0 end-1] != [lrange $fields2 0 end-1]
+           || ![string is double -strict [lindex $fields1 end]]
+           || ![string is double -strict [lindex $fields2 end]]
+           || abs([lindex $fields1 end] - [lindex $fields2 end]) > $tolerance } {
+        set found_diff 1
+        break
+      }
+    }
+    incr line
+    set line1_length [gets $stream1 line1]
+    set line2_length [gets $stream2 line2]
+  }
+  close $stream1
+  close $stream2
+  if { $found_diff || $line1_length != $line2_length } {
+    puts "Differences found at line $line."
+    puts "$line1"
+    puts "$line2"
+    return 1
+  } else {
+    puts "No differences found."
+    return 0
+  }
+}
+
+diff_voltage_files $voltage_file gcd_test_vdd-voltage.rptok 2e-6
@@ -0,0 +1,25 @@
+# Repeated solves reuse the G factorization and the preconditioner.
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+set voltage_file1 [make_result_file gcd_test_vdd_reuse-voltage1.rpt]
+set voltage_file2 [make_result_file gcd_test_vdd_reuse-voltage2.rpt]
+set iterative_file1 [make_result_file gcd_test_vdd_reuse-iterative1.rpt]
+set iterative_file2 [make_result_file gcd_test_vdd_reuse-iterative2.rpt]
+
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $voltage_file1 -net VDD
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $voltage_file2 -net VDD
+
+diff_files $voltage_file1 gcd_test_vdd-voltage.rptok
+diff_files $voltage_file2 gcd_test_vdd-voltage.rptok
+
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $iterative_file1 \
+  -net VDD -use_iterative_solver
+analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $iterative_file2 \
+  -net VDD -use_iterative_solver
+
+diff_files $iterative_file1 $iterative_file2
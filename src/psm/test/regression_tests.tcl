@@ -2,6 +2,8 @@ record_tests {
   aes_test_vdd
   aes_test_vss
   gcd_test_vdd
+  gcd_test_vdd_iterative
+  gcd_test_vdd_reuse
   gcd_no_vsrc
   gcd_write_sp_test_vdd
   gcd_all_vss
@@ -118,6 +118,7 @@ class Ext
     int context_depth = 5;
     int cc_model = 10;
     bool lef_res = false;
+    int thread_count = 1;
   };
 
   void extract(ExtractOptions options);
@@ -141,10 +142,11 @@ class Ext
     const int corner = -1;
     const int debug = 0;
     const bool parallel = false;
+    int thread_count = 1;
     const bool init = false;
     const bool end = false;
     const bool use_ids = false;
-    const bool no_name_map = false;
+    bool no_name_map = false;
     const char* N = nullptr;
     const bool term_junction_xy = false;
     const bool single_pi = false;
@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <vector>
 
 #include "ext2dBox.h"
 #include "extprocess.h"
@@ -1230,6 +1232,17 @@ class extCorner
   extCorner* _extCornerPtr;
 };
 
+// A non-via wire shape of a net, decoded once per coupling flow so that
+// every extraction band only visits the shapes that fall into it.
+struct extWireShape
+{
+  odb::Rect box;
+  odb::dbTechLayer* layer;
+  uint id;       // net id of a signal wire, sbox id of a power wire
+  uint shapeId;  // wire shape id of a signal wire, 0 for a power wire
+  bool plane;    // added to the pixel planes of both directions
+};
+
 class extMain
 {
  public:
@@ -1260,6 +1273,7 @@ class extMain
       _debug_net_id = atoi(nets);
     }
   }
+  void setThreadCount(int threads) { _threadCount = std::max(threads, 1); }
 
   static void createShapeProperty(odb::dbNet* net, int id, int id_val);
   static int getShapeProperty(odb::dbNet* net, int id);
@@ -1313,6 +1327,16 @@ class extMain
                      int* bb_ur,
                      uint wtype,
                      dbCreateNetUtil* createDbNet = nullptr);
+  void loadWireShapes();
+  void releaseWireShapes();
+  void getBandShapes(const std::vector<extWireShape>& shapes,
+                     const std::vector<uint>& order,
+                     uint dir,
+                     const int* bb_ll,
+                     const int* bb_ur,
+                     std::vector<uint>& band);
+  uint addPowerShapes(uint dir, int* bb_ll, int* bb_ur, uint wtype);
+  uint addSignalShapes(uint dir, int* bb_ll, int* bb_ur, uint wtype);
   uint addNets(uint dir,
                int* bb_ll,
                int* bb_ur,
@@ -1549,6 +1573,7 @@ class extMain
                  const char* spef_version);
   void writeSPEF(char* filename,
                  char* netNames,
+                 uint netId,
                  bool noNameMap,
                  char* nodeCoord,
                  bool termJxy,
@@ -2214,6 +2239,15 @@ class extMain
   uint _debug_net_id = 0;
   float _previous_percent_extracted = 0;
 
+  int _threadCount = 1;
+  // Wire shapes of supply and signal nets in net order, and per direction
+  // the indices of the shapes extracted in that direction sorted by their
+  // low coordinate.
+  std::vector<extWireShape> _powerShapes;
+  std::vector<extWireShape> _signalShapes;
+  std::vector<uint> _powerShapeOrder[2];
+  std::vector<uint> _signalShapeOrder[2];
+
   double _minCapTable[64][64];
   double _maxCapTable[64][64];
   double _minResTable[64][64];
@@ -33,6 +33,8 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "extRCap.h"
 #include "odb/array1.h"
@@ -91,6 +93,7 @@ class extSpef
                   bool noBackSlash,
                   bool parallel);
   void incr_rRun() { _rRun++; };
+  void setThreadCount(int threads) { _threadCount = std::max(threads, 1); }
   void setCornerCnt(uint n);
   uint readBlock(uint debug,
                  const std::vector<odb::dbNet*>& tnets,
@@ -167,6 +170,9 @@ class extSpef
                   bool noBackSlash,
                   bool parallel);
 
+  void writeNets(const std::vector<odb::dbNet*>& nets);
+  std::unique_ptr<extSpef> makeNetWriter();
+
   void writeITerm(uint node);
   void writeBTerm(uint node);
   void writeNode(uint netId, uint node);
@@ -272,6 +278,7 @@ class extSpef
   uint setRCCaps(odb::dbNet* net);
 
   uint getMinCapNode(odb::dbNet* net, uint* minNode);
+  uint getCapNodeSortIndex(uint nodeId) const;
   void computeCaps(odb::dbSet<odb::dbRSeg>& rcSet, double* totCap);
   uint getMappedCapNode(uint nodeId);
   void writePorts(odb::dbNet* net);
@@ -372,7 +379,6 @@ class extSpef
   int _ind_unit = 1;
 
   uint _cornerCnt = 0;
-  uint _cornersPerBlock;
 
   bool _extracted = false;
 
@@ -395,26 +401,16 @@ class extSpef
   bool _partial = false;
   bool _btermFound;
 
-  bool _noBackSlash = false;
-
-  uint _baseNameMap = 0;
   uint _firstCapNode;
-
-  bool _preserveCapValues = false;
-  bool _symmetricCCcaps = true;
+  // Sort index of each cap node of the net being written, by node id minus
+  // _capNodeSortBase.
+  std::vector<uint> _capNodeSortIndex;
+  uint _capNodeSortBase = 0;
 
   bool _testParsing = false;
 
   uint _tnetCnt;
 
-  bool _wOnlyClock;
-  bool _wConn = false;
-  bool _wCap = false;
-  bool _wOnlyCCcap = false;
-  bool _wRes = false;
-  bool _noCnum = false;
-  bool _foreign = false;
-
   uint _rRun = 0;
   bool _stampWire = false;
   bool _rConn = false;
@@ -444,6 +440,7 @@ class extSpef
   uint _minNetNode;
 
   bool _gzipFlag = false;
+  int _threadCount = 1;
   bool _stopAfterNameMap = false;
   float _upperCalibLimit;
   float _lowerCalibLimit;
@@ -479,8 +476,6 @@ class extSpef
   char* _netExcludeSubWord = nullptr;
   FILE* _capStatsFP = nullptr;
 
-  bool _singleP = false;
-
   std::vector<odb::dbNet*> _netV1;
 
   Ath__array1D<uint>* _capNodeTable = nullptr;
@@ -497,7 +492,6 @@ class extSpef
   bool _doSortRSeg = true;
   COORD_TYPE _readingNodeCoordsInput;
   COORD_TYPE _readingNodeCoords = C_NONE;
-  COORD_TYPE _writingNodeCoords = C_NONE;
 
   int _fixloop;
   uint _breakLoopNet;
@@ -513,22 +507,42 @@ class extSpef
   bool _readAllCorners = false;
   int _in_spef_corner = -1;
 
-  uint _childBlockInstBaseMap = 0;
-  uint _childBlockNetBaseMap = 0;
-
   Logger* logger_;
 
  public:
+  // The write_spef output options.  makeNetWriter copies them as a whole
+  // into the writers of the other threads.
+  struct WriteSettings
+  {
+    bool only_clock = false;
+    bool conn = false;
+    bool cap = false;
+    bool only_cc_cap = false;
+    bool res = false;
+    bool no_cnum = false;
+    bool no_back_slash = false;
+    bool foreign = false;
+    bool name_map = true;
+    bool term_jxy = false;
+    bool preserve_cap_values = false;
+    bool symmetric_cc_caps = true;
+    bool single_pi = false;
+    COORD_TYPE node_coords = C_NONE;
+    uint base_name_map = 0;
+    uint child_block_inst_base_map = 0;
+    uint child_block_net_base_map = 0;
+    uint corners_per_block = 0;
+    int active_corner_cnt = 0;
+    int active_corner_number[32];
+  };
+  WriteSettings _write;
+
   bool _addRepeatedCapValue = true;
   bool _noCapNumCollapse = false;
   FILE* _capNodeFile = nullptr;
   int _db_calibbase_corner;
   int _db_ext_corner = -1;
-  int _active_corner_cnt = 0;
-  int _active_corner_number[32];
-  bool _writeNameMap;
   bool _moreToRead;
-  bool _termJxy = false;
   bool _incrPlusCcNets = false;
   odb::dbBTerm* _ccbterm1;
   odb::dbBTerm* _ccbterm2;
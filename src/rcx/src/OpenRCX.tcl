@@ -127,12 +127,13 @@ sta::define_cmd_args "write_spef" {
   [-net_id net_id]
   [-nets nets]
   [-coordinates]
+  [-no_name_map]
   filename }
 
 proc write_spef { args } {
   sta::parse_key_args "write_spef" args \
     keys { -net_id -nets } \
-    flags { -coordinates }
+    flags { -coordinates -no_name_map }
   sta::check_argc_eq1 "write_spef" $args
 
   set spef_file $args
@@ -148,8 +149,9 @@ proc write_spef { args } {
   }
 
   set coordinates [info exists flags(-coordinates)]
+  set no_name_map [info exists flags(-no_name_map)]
 
-  rcx::write_spef $spef_file $nets $net_id $coordinates
+  rcx::write_spef $spef_file $nets $net_id $coordinates $no_name_map
 }
 
 sta::define_cmd_args "adjust_rc" {
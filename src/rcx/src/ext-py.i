@@ -58,7 +58,7 @@ void extract(const char* ext_model_file,
              bool no_merge_via_res);
 
 void write_spef(const char* file, const char* nets, int net_id,
-                bool write_coordinates);
+                bool write_coordinates, bool no_name_map);
 
 void adjust_rc(double res_factor,
                double cc_factor,
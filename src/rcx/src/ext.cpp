@@ -235,10 +235,11 @@ void Ext::extract(ExtractOptions options)
   _ext->setBlockFromChip();
   odb::dbBlock* block = _ext->getBlock();
 
-  odb::orderWires(logger_, block);
+  odb::orderWires(logger_, block, options.thread_count);
 
   _ext->set_debug_nets(options.debug_net);
   _ext->_lef_res = options.lef_res;
+  _ext->setThreadCount(options.thread_count);
 
   _ext->makeBlockRCsegs(options.net,
                         options.cc_up,
@@ -267,14 +268,17 @@ void Ext::write_spef_nets(odb::dbObject* block,
 void Ext::write_spef(const SpefOptions& options)
 {
   _ext->setBlockFromChip();
+  _ext->setThreadCount(options.thread_count);
   if (options.end) {
     _ext->writeSPEF(true);
     return;
   }
   const char* name = options.ext_corner_name;
 
+  // Without a file a single net is appended to the SPEF opened by an
+  // earlier write.
   uint netId = options.net_id;
-  if (netId > 0) {
+  if (netId > 0 && options.file == nullptr) {
     _ext->writeSPEF(netId,
                     options.single_pi,
                     options.debug,
@@ -285,6 +289,7 @@ void Ext::write_spef(const SpefOptions& options)
   }
   _ext->writeSPEF((char*) options.file,
                   (char*) options.nets,
+                  netId,
                   options.no_name_map,
                   (char*) options.N,
                   options.term_junction_xy,
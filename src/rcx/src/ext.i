@@ -84,6 +84,7 @@ extract(const char* ext_model_file,
   opts.lef_res = lef_res;
   opts.debug_net = debug_net_id;
   opts.no_merge_via_res = no_merge_via_res;
+  opts.thread_count = ord::OpenRoad::openRoad()->getThreadCount();
   
   ext->extract(opts);
 }
@@ -92,7 +93,8 @@ void
 write_spef(const char* file,
            const char* nets,
            int net_id,
-           bool write_coordinates)
+           bool write_coordinates,
+           bool no_name_map)
 {
   Ext* ext = getOpenRCX();
   Ext::SpefOptions opts;
@@ -102,6 +104,8 @@ write_spef(const char* file,
   if (write_coordinates) {
     opts.N = "Y";
   }
+  opts.no_name_map = no_name_map;
+  opts.thread_count = ord::OpenRoad::openRoad()->getThreadCount();
   
   ext->write_spef(opts);
 }
@@ -828,6 +828,182 @@ uint extMain::addSignalNets(uint dir,
   return cnt;
 }
 
+void extMain::loadWireShapes()
+{
+  std::vector<dbNet*> nets;
+  for (dbNet* net : _block->getNets()) {
+    nets.push_back(net);
+  }
+
+  // Decoding the wires is read only, so the nets are decoded concurrently
+  // into per net tables that are then appended in net order.
+  std::vector<std::vector<extWireShape>> netShapes(nets.size());
+
+#pragma omp parallel for num_threads(_threadCount) schedule(dynamic, 64)
+  for (int ii = 0; ii < (int) nets.size(); ii++) {
+    dbNet* net = nets[ii];
+    std::vector<extWireShape>& shapes = netShapes[ii];
+
+    if (net->getSigType().isSupply()) {
+      for (dbSWire* swire : net->getSWires()) {
+        for (dbSBox* s : swire->getWires()) {
+          if (s->isVia()) {
+            continue;
+          }
+          shapes.push_back(
+              {s->getBox(), s->getTechLayer(), s->getId(), 0, true});
+        }
+      }
+      continue;
+    }
+
+    dbWire* wire = net->getWire();
+    if (wire == nullptr) {
+      continue;
+    }
+
+    const bool plane = net->getSigType() == dbSigType::ANALOG;
+
+    dbWireShapeItr itr;
+    dbShape s;
+    for (itr.begin(wire); itr.next(s);) {
+      if (s.isVia()) {
+        continue;
+      }
+      shapes.push_back({s.getBox(),
+                        s.getTechLayer(),
+                        net->getId(),
+                        (uint) itr.getShapeId(),
+                        plane});
+    }
+  }
+
+  releaseWireShapes();
+  for (uint ii = 0; ii < nets.size(); ii++) {
+    std::vector<extWireShape>& table = nets[ii]->getSigType().isSupply()
+                                           ? _powerShapes
+                                           : _signalShapes;
+    table.insert(table.end(), netShapes[ii].begin(), netShapes[ii].end());
+  }
+
+  auto sortShapes = [this](const std::vector<extWireShape>& shapes,
+                           std::vector<uint>* order) {
+    for (uint ii = 0; ii < shapes.size(); ii++) {
+      Rect r = shapes[ii].box;
+      order[matchDir(1, r) ? 1 : 0].push_back(ii);
+    }
+    for (uint dir = 0; dir < 2; dir++) {
+      std::sort(order[dir].begin(),
+                order[dir].end(),
+                [&shapes, dir](uint a, uint b) {
+                  const int xy_a = dir ? shapes[a].box.yMin()
+                                       : shapes[a].box.xMin();
+                  const int xy_b = dir ? shapes[b].box.yMin()
+                                       : shapes[b].box.xMin();
+                  return xy_a < xy_b || (xy_a == xy_b && a < b);
+                });
+    }
+  };
+  sortShapes(_powerShapes, _powerShapeOrder);
+  sortShapes(_signalShapes, _signalShapeOrder);
+}
+
+void extMain::releaseWireShapes()
+{
+  _powerShapes.clear();
+  _signalShapes.clear();
+  for (uint dir = 0; dir < 2; dir++) {
+    _powerShapeOrder[dir].clear();
+    _signalShapeOrder[dir].clear();
+  }
+}
+
+// Collects, in net order, the shapes of the given direction whose low
+// coordinate is within [bb_ll, bb_ur), the same shapes isIncludedInsearch
+// accepts.
+void extMain::getBandShapes(const std::vector<extWireShape>& shapes,
+                            const std::vector<uint>& order,
+                            uint dir,
+                            const int* bb_ll,
+                            const int* bb_ur,
+                            std::vector<uint>& band)
+{
+  auto lowerXY = [&shapes, dir](uint idx, int xy) {
+    const Rect& r = shapes[idx].box;
+    return (dir ? r.yMin() : r.xMin()) < xy;
+  };
+  auto lo = std::lower_bound(order.begin(), order.end(), bb_ll[dir], lowerXY);
+  auto hi = std::lower_bound(lo, order.end(), bb_ur[dir], lowerXY);
+
+  band.assign(lo, hi);
+  std::sort(band.begin(), band.end());
+}
+
+uint extMain::addPowerShapes(uint dir, int* bb_ll, int* bb_ur, uint wtype)
+{
+  std::vector<uint> band;
+  getBandShapes(_powerShapes, _powerShapeOrder[dir], dir, bb_ll, bb_ur, band);
+
+  for (uint idx : band) {
+    const extWireShape& s = _powerShapes[idx];
+    _search->addBox(s.box.xMin(),
+                    s.box.yMin(),
+                    s.box.xMax(),
+                    s.box.yMax(),
+                    s.layer->getRoutingLevel(),
+                    s.id,
+                    0,
+                    wtype);
+  }
+  return band.size();
+}
+
+uint extMain::addSignalShapes(uint dir, int* bb_ll, int* bb_ur, uint wtype)
+{
+  std::vector<uint> band;
+  getBandShapes(
+      _signalShapes, _signalShapeOrder[dir], dir, bb_ll, bb_ur, band);
+
+  for (uint idx : band) {
+    const extWireShape& s = _signalShapes[idx];
+    const Rect& r = s.box;
+    const uint level = s.layer->getRoutingLevel();
+    const uint trackNum = _search->addBox(r.xMin(),
+                                          r.yMin(),
+                                          r.xMax(),
+                                          r.yMax(),
+                                          level,
+                                          s.id,
+                                          s.shapeId,
+                                          wtype);
+    if (s.id == _debug_net_id) {
+      debugPrint(logger_,
+                 RCX,
+                 "debug_net",
+                 1,
+                 "\t[Search:W]"
+                 "\tonSearch: tr={} L{}  DX={} DY={} {} {}  {} {} -- {:.3f} "
+                 "{:.3f}  {:.3f} {:.3f} net {}",
+                 trackNum,
+                 level,
+                 r.dx(),
+                 r.dy(),
+                 r.xMin(),
+                 r.yMin(),
+                 r.xMax(),
+                 r.yMax(),
+                 GetDBcoords1(r.xMin()),
+                 GetDBcoords1(r.yMin()),
+                 GetDBcoords1(r.xMax()),
+                 GetDBcoords1(r.yMax()),
+                 s.id);
+    }
+  }
+  _search->adjustOverlapMakerEnd();
+
+  return band.size();
+}
+
 void extMain::resetNetSpefFlag(Ath__array1D<uint>* tmpNetIdTable)
 {
   for (uint ii = 0; ii < tmpNetIdTable->getCnt(); ii++) {
@@ -1131,29 +1307,15 @@ uint extMain::fill_gs4(int dir,
   const int gs_dir = dir;
 
   uint pcnt = 0;
-  dbSet<dbNet> nets = _block->getNets();
-  dbSet<dbNet>::iterator net_itr;
-
-  for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
-    dbNet* net = *net_itr;
-
-    if (!((net->getSigType().isSupply()))) {
-      continue;
-    }
-
-    pcnt += addNetSboxesGs(net, rotatedGs, !dir, gs_dir);
+  for (extWireShape& s : _powerShapes) {
+    pcnt += addShapeOnGS(
+        nullptr, s.id, s.box, true, s.layer, rotatedGs, !dir, gs_dir);
   }
 
   uint scnt = 0;
-
-  for (net_itr = nets.begin(); net_itr != nets.end(); ++net_itr) {
-    dbNet* net = *net_itr;
-
-    if ((net->getSigType().isSupply())) {
-      continue;
-    }
-
-    scnt += addNetShapesGs(net, rotatedGs, !dir, gs_dir);
+  for (extWireShape& s : _signalShapes) {
+    scnt += addShapeOnGS(
+        nullptr, s.shapeId, s.box, s.plane, s.layer, rotatedGs, !dir, gs_dir);
   }
 
   return pcnt + scnt;
@@ -1229,6 +1391,8 @@ uint extMain::couplingFlow(Rect& extRect,
   uint totWireCnt = signalWireCounter(maxWidth);
   totWireCnt += totPowerWireCnt;
 
+  loadWireShapes();
+
   uint minRes[2];
   minRes[1] = pitchTable[1];
   minRes[0] = widthTable[1];
@@ -1310,8 +1474,8 @@ uint extMain::couplingFlow(Rect& extRect,
       hi_sdb[dir] = hiXY;
 
       uint processWireCnt = 0;
-      processWireCnt += addPowerNets(dir, lo_sdb, hi_sdb, pwrtype);
-      processWireCnt += addSignalNets(dir, lo_sdb, hi_sdb, sigtype);
+      processWireCnt += addPowerShapes(dir, lo_sdb, hi_sdb, pwrtype);
+      processWireCnt += addSignalShapes(dir, lo_sdb, hi_sdb, sigtype);
 
       uint extractedWireCnt = 0;
       int extractLimit = hiXY - ccDist * maxPitch;
@@ -1366,6 +1530,8 @@ uint extMain::couplingFlow(Rect& extRect,
   delete _geomSeq;
   _geomSeq = nullptr;
 
+  releaseWireShapes();
+
   for (uint jj = 0; jj < layerCnt; jj++) {
     delete[] limitArray[jj];
   }
@@ -33,6 +33,9 @@
 #include "rcx/extSpef.h"
 
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
 
 #include "name.h"
 #include "odb/dbExtControl.h"
@@ -122,7 +125,7 @@ void extSpef::setBlock(odb::dbBlock* blk)
 
 void extSpef::set_single_pi(const bool v)
 {
-  _singleP = v;
+  _write.single_pi = v;
 }
 
 void extSpef::setLogger(Logger* logger)
@@ -203,7 +206,7 @@ void extSpef::setUseIdsFlag(const bool diff, const bool calib)
 
 void extSpef::preserveFlag(const bool v)
 {
-  _preserveCapValues = v;
+  _write.preserve_cap_values = v;
 }
 
 void extSpef::setCornerCnt(const uint n)
@@ -275,11 +278,11 @@ void extSpef::setDesign(const char* name)
 
 uint extSpef::getInstMapId(const uint id)
 {
-  if (_childBlockInstBaseMap > 0) {
-    return _childBlockInstBaseMap + id;
+  if (_write.child_block_inst_base_map > 0) {
+    return _write.child_block_inst_base_map + id;
   }
 
-  return _baseNameMap + id;
+  return _write.base_name_map + id;
 }
 
 void extSpef::writeNameNode(odb::dbCapNode* node)
@@ -304,7 +307,7 @@ void extSpef::writeITermNode(const uint node)
 
   char ttname[256];
   if (_bufString) {
-    if (_writeNameMap) {
+    if (_write.name_map) {
       sprintf(_msgBuf1,
               "*%d%s%s ",
               getInstMapId(inst->getId()),
@@ -319,7 +322,7 @@ void extSpef::writeITermNode(const uint node)
     }
     strcat(_bufString, _msgBuf1);
   } else {
-    if (_writeNameMap) {
+    if (_write.name_map) {
       fprintf(_outFP,
               "*%d%s%s ",
               getInstMapId(inst->getId()),
@@ -349,14 +352,14 @@ void extSpef::writeITerm(const uint node)
   fprintf(_outFP, "%c ", io);
   const int dbunit = _block->getDbUnitsPerMicron();
   const double db2nm = 1.0 / dbunit;
-  if (_writingNodeCoords == C_ON) {
+  if (_write.node_coords == C_ON) {
     int jid = 0;
     odb::dbWire* wire = _d_net->getWire();
     if (wire) {
       jid = wire->getTermJid(iterm->getId());
     }
     odb::Point pt;
-    if (_termJxy && jid) {
+    if (_write.term_jxy && jid) {
       pt = wire->getCoord(jid);
     } else {
       int x1 = 0;
@@ -386,7 +389,7 @@ void extSpef::writeNode(const uint netId, const uint node)
 {
   odb::dbNet* tnet = _d_net;
   if (_bufString) {
-    if (_writeNameMap) {
+    if (_write.name_map) {
       sprintf(_msgBuf1, "*%d%s%d ", netId, _delimiter, node);
     } else {
       sprintf(_msgBuf1,
@@ -397,7 +400,7 @@ void extSpef::writeNode(const uint netId, const uint node)
     }
     strcat(_bufString, _msgBuf1);
   } else {
-    if (_writeNameMap) {
+    if (_write.name_map) {
       fprintf(_outFP, "*%d%s%d ", netId, _delimiter, node);
     } else {
       fprintf(_outFP,
@@ -426,8 +429,8 @@ void extSpef::writeCapNode(odb::dbCapNode* capNode, uint netId)
   } else if (capNode->isBTerm()) {
     writeBTerm(capNode->getNode());
   } else if (capNode->isInternal()) {
-    if (_childBlockNetBaseMap > 0) {
-      netId += _childBlockNetBaseMap;
+    if (_write.child_block_net_base_map > 0) {
+      netId += _write.child_block_net_base_map;
     }
 
     writeNode(netId, capNode->getNode());
@@ -479,7 +482,7 @@ void extSpef::writePort(const uint node)
           "*P %s %c",
           addEscChar(bterm->getName().c_str(), false),
           bterm->getIoType().getString()[0]);
-  if (_writingNodeCoords != C_ON) {
+  if (_write.node_coords != C_ON) {
     fprintf(_outFP, "\n");
     return;
   }
@@ -491,7 +494,7 @@ void extSpef::writePort(const uint node)
     jid = wire->getTermJid(-bterm->getId());
   }
   odb::Point pt;
-  if (_termJxy && jid) {
+  if (_write.term_jxy && jid) {
     pt = wire->getCoord(jid);
   } else {
     int x1 = 0;
@@ -513,10 +516,12 @@ void extSpef::writeSingleRC(const double val, const bool delimeter)
 
 void extSpef::writeRCvalue(const double* totCap, const double units)
 {
-  fprintf(_outFP, "%g", totCap[_active_corner_number[0]] * units);
-  for (int ii = 1; ii < _active_corner_cnt; ii++) {
-    fprintf(
-        _outFP, "%s%g", _delimiter, totCap[_active_corner_number[ii]] * units);
+  fprintf(_outFP, "%g", totCap[_write.active_corner_number[0]] * units);
+  for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
+    fprintf(_outFP,
+            "%s%g",
+            _delimiter,
+            totCap[_write.active_corner_number[ii]] * units);
   }
 }
 
@@ -524,7 +529,7 @@ void extSpef::writeDnet(uint netId, const double* totCap)
 {
   netId = getNetMapId(netId);
 
-  if (_writeNameMap) {
+  if (_write.name_map) {
     fprintf(_outFP, "\n*D_NET *%d ", netId);
   } else {
     fprintf(_outFP,
@@ -626,13 +631,11 @@ void extSpef::computeCaps(odb::dbSet<odb::dbRSeg>& rcSet, double* totCap)
     addCap(cap, totCap, this->_cornerCnt);
 
     const uint trgNodeId = rc->getTargetNode();
-    const uint trgMappedNode
-        = odb::dbCapNode::getCapNode(_cornerBlock, trgNodeId)->getSortIndex();
+    const uint trgMappedNode = getCapNodeSortIndex(trgNodeId);
     addHalfCap(_nodeCapTable->geti(trgMappedNode), cap);
 
     const uint srcNodeId = rc->getSourceNode();
-    const uint srcMappedNode
-        = odb::dbCapNode::getCapNode(_cornerBlock, srcNodeId)->getSortIndex();
+    const uint srcMappedNode = getCapNodeSortIndex(srcNodeId);
     addHalfCap(_nodeCapTable->geti(srcMappedNode), cap);
   }
 }
@@ -646,8 +649,7 @@ void extSpef::computeCapsAdd2Target(odb::dbSet<odb::dbRSeg>& rcSet,
     addCap(cap, totCap, this->_cornerCnt);
 
     const uint trgNodeId = rc->getTargetNode();
-    const uint trgMappedNode
-        = odb::dbCapNode::getCapNode(_block, trgNodeId)->getSortIndex();
+    const uint trgMappedNode = getCapNodeSortIndex(trgNodeId);
     adjustCap(_nodeCapTable->geti(trgMappedNode), cap);
   }
 }
@@ -656,22 +658,22 @@ void extSpef::getCaps(odb::dbNet* net, double* totCap)
 {
   for (odb::dbCapNode* node : net->getCapNodes()) {
     double cap[ADS_MAX_CORNER];
-    for (uint ii = 0; ii < _cornersPerBlock; ii++) {
+    for (uint ii = 0; ii < _write.corners_per_block; ii++) {
       cap[ii] = node->getCapacitance(ii);
     }
 
-    addCap(cap, totCap, _cornersPerBlock);
+    addCap(cap, totCap, _write.corners_per_block);
   }
 }
 
 void extSpef::addCouplingCaps(odb::dbNet* net, double* totCap)
 {
   double cap[ADS_MAX_CORNER];
-  for (uint ii = 0; ii < _cornersPerBlock; ii++) {
+  for (uint ii = 0; ii < _write.corners_per_block; ii++) {
     cap[ii] = net->getTotalCouplingCap(ii);
   }
 
-  addCap(cap, totCap, _cornersPerBlock);
+  addCap(cap, totCap, _write.corners_per_block);
 }
 
 void extSpef::addCouplingCaps(odb::dbSet<odb::dbCCSeg>& capSet, double* totCap)
@@ -686,27 +688,41 @@ void extSpef::addCouplingCaps(odb::dbSet<odb::dbCCSeg>& capSet, double* totCap)
   }
 }
 
+// Number the cap nodes of the net in this writer rather than in the db cap
+// node flags, which writers of other nets read concurrently.
 uint extSpef::getMinCapNode(odb::dbNet* net, uint* minNode)
 {
   uint cnt = 0;
   uint min = std::numeric_limits<uint>::max();
-  for (odb::dbCapNode* node : net->getCapNodes()) {
+  uint max = 0;
+  odb::dbSet<odb::dbCapNode> nodes = net->getCapNodes();
+  for (odb::dbCapNode* node : nodes) {
     cnt++;
-    node->setSortIndex(cnt);
-
     min = std::min(min, node->getId());
+    max = std::max(max, node->getId());
   }
   if (cnt == 0) {
     *minNode = 0;
     return 0;
   }
+  _capNodeSortBase = min;
+  _capNodeSortIndex.assign(max - min + 1, 0);
+  cnt = 0;
+  for (odb::dbCapNode* node : nodes) {
+    _capNodeSortIndex[node->getId() - min] = ++cnt;
+  }
   *minNode = min;
   return cnt + 1;
 }
 
+uint extSpef::getCapNodeSortIndex(const uint nodeId) const
+{
+  return _capNodeSortIndex[nodeId - _capNodeSortBase];
+}
+
 void extSpef::writeCNodeNumber()
 {
-  if (_noCnum) {
+  if (_write.no_cnum) {
     return;
   }
   fprintf(_outFP, "%d ", _cCnt++);
@@ -742,9 +758,11 @@ void extSpef::writeInternalCaps(odb::dbNet* net,
     writeCNodeNumber();
     writeNode(net->getId(), capNode->getNode());
 
-    writeSingleRC(capNode->getCapacitance(_active_corner_number[0]), false);
-    for (int ii = 1; ii < _active_corner_cnt; ii++) {
-      writeSingleRC(capNode->getCapacitance(_active_corner_number[ii]), true);
+    writeSingleRC(capNode->getCapacitance(_write.active_corner_number[0]),
+                  false);
+    for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
+      writeSingleRC(capNode->getCapacitance(_write.active_corner_number[ii]),
+                    true);
     }
 
     fprintf(_outFP, "\n");
@@ -778,9 +796,11 @@ void extSpef::writeCapPortsAndIterms(odb::dbSet<odb::dbCapNode>& capSet,
       continue;
     }
 
-    writeSingleRC(capNode->getCapacitance(_active_corner_number[0]), false);
-    for (int ii = 1; ii < _active_corner_cnt; ii++) {
-      writeSingleRC(capNode->getCapacitance(_active_corner_number[ii]), true);
+    writeSingleRC(capNode->getCapacitance(_write.active_corner_number[0]),
+                  false);
+    for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
+      writeSingleRC(capNode->getCapacitance(_write.active_corner_number[ii]),
+                    true);
     }
 
     fprintf(_outFP, "\n");
@@ -794,7 +814,7 @@ void extSpef::writeCapPorts(odb::dbNet* net)
       continue;
     }
 
-    writeCapPort(capNode->getNode(), capNode->getSortIndex());
+    writeCapPort(capNode->getNode(), getCapNodeSortIndex(capNode->getId()));
   }
 }
 
@@ -815,9 +835,9 @@ void extSpef::writeCapITerms(odb::dbNet* net)
 {
   for (odb::dbCapNode* capNode : net->getCapNodes()) {
     if (capNode->isITerm()) {
-      writeCapITerm(capNode->getNode(), capNode->getSortIndex());
+      writeCapITerm(capNode->getNode(), getCapNodeSortIndex(capNode->getId()));
     } else if (capNode->isName()) {  // coming from lower level
-      writeCapName(capNode, capNode->getSortIndex());
+      writeCapName(capNode, getCapNodeSortIndex(capNode->getId()));
     }
   }
 }
@@ -833,7 +853,7 @@ void extSpef::writeNodeCaps(odb::dbNet* net, uint netId)
       continue;
     }
 
-    const uint capNodeId = capNode->getSortIndex();
+    const uint capNodeId = getCapNodeSortIndex(capNode->getId());
     writeNodeCap(netId, capNodeId, capNode->getNode());
   }
 }
@@ -933,13 +953,15 @@ void extSpef::writeCouplingCapsNoSort(odb::dbSet<odb::dbCCSeg>& capSet,
     writeCapNode(cc->getSourceCapNode()->getId(), netId);
     writeCapNode(cc->getTargetCapNode()->getId(), netId);
 
-    fprintf(
-        _outFP, "%g", cc->getCapacitance(_active_corner_number[0]) * _cap_unit);
-    for (int ii = 1; ii < _active_corner_cnt; ii++) {
+    fprintf(_outFP,
+            "%g",
+            cc->getCapacitance(_write.active_corner_number[0])
+                * _cap_unit);
+    for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
       fprintf(_outFP,
               "%s%g",
               _delimiter,
-              cc->getCapacitance(_active_corner_number[ii]) * _cap_unit);
+              cc->getCapacitance(_write.active_corner_number[ii]) * _cap_unit);
     }
     fprintf(_outFP, "\n");
   }
@@ -948,7 +970,7 @@ void extSpef::writeCouplingCapsNoSort(odb::dbSet<odb::dbCCSeg>& capSet,
 void extSpef::writeCouplingCaps(odb::dbSet<odb::dbCCSeg>& capSet,
                                 const uint netId)
 {
-  if (_preserveCapValues) {
+  if (_write.preserve_cap_values) {
     return writeCouplingCapsNoSort(capSet, netId);
   }
 
@@ -960,13 +982,15 @@ void extSpef::writeCouplingCaps(odb::dbSet<odb::dbCCSeg>& capSet,
     writeCapNode(cc->getSourceCapNode()->getId(), netId);
     writeCapNode(cc->getTargetCapNode()->getId(), netId);
 
-    fprintf(
-        _outFP, "%g", cc->getCapacitance(_active_corner_number[0]) * _cap_unit);
-    for (int ii = 1; ii < _active_corner_cnt; ii++) {
+    fprintf(_outFP,
+            "%g",
+            cc->getCapacitance(_write.active_corner_number[0])
+                * _cap_unit);
+    for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
       fprintf(_outFP,
               "%s%g",
               _delimiter,
-              cc->getCapacitance(_active_corner_number[ii]) * _cap_unit);
+              cc->getCapacitance(_write.active_corner_number[ii]) * _cap_unit);
     }
     fprintf(_outFP, "\n");
   }
@@ -977,7 +1001,7 @@ void extSpef::writeTgtCouplingCaps(odb::dbNet* net, const uint netId)
   std::vector<odb::dbCCSeg*> vec_cc;
   net->getTgtCCSegs(vec_cc);
 
-  if (!_preserveCapValues) {
+  if (!_write.preserve_cap_values) {
     std::sort(vec_cc.begin(), vec_cc.end(), compareCC());
   }
 
@@ -989,7 +1013,7 @@ void extSpef::writeSrcCouplingCaps(odb::dbNet* net, const uint netId)
   std::vector<odb::dbCCSeg*> vec_cc;
   net->getSrcCCSegs(vec_cc);
 
-  if (!_preserveCapValues) {
+  if (!_write.preserve_cap_values) {
     std::sort(vec_cc.begin(), vec_cc.end(), compareCC());
   }
 
@@ -1011,12 +1035,14 @@ void extSpef::writeCouplingCaps(const std::vector<odb::dbCCSeg*>& vec_cc,
               "CC of net %d %s with capacitance %g",
               _d_net->getId(),
               _d_net->getConstName(),
-              cc->getCapacitance(_active_corner_number[0]) * _cap_unit);
-      for (int ii = 1; ii < _active_corner_cnt; ii++) {
+              cc->getCapacitance(_write.active_corner_number[0])
+                * _cap_unit);
+      for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
         sprintf(&msg1[0],
                 "%s%g",
                 _delimiter,
-                cc->getCapacitance(_active_corner_number[ii]) * _cap_unit);
+                cc->getCapacitance(_write.active_corner_number[ii])
+                    * _cap_unit);
         strcat(_bufString, &msg1[0]);
       }
       strcat(_bufString, " has both capNodes ");
@@ -1029,13 +1055,15 @@ void extSpef::writeCouplingCaps(const std::vector<odb::dbCCSeg*>& vec_cc,
     writeCapNode(cc->getSourceCapNode(), netId);
     writeCapNode(cc->getTargetCapNode(), netId);
 
-    fprintf(
-        _outFP, "%g", cc->getCapacitance(_active_corner_number[0]) * _cap_unit);
-    for (int ii = 1; ii < _active_corner_cnt; ii++) {
+    fprintf(_outFP,
+            "%g",
+            cc->getCapacitance(_write.active_corner_number[0])
+                * _cap_unit);
+    for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
       fprintf(_outFP,
               "%s%g",
               _delimiter,
-              cc->getCapacitance(_active_corner_number[ii]) * _cap_unit);
+              cc->getCapacitance(_write.active_corner_number[ii]) * _cap_unit);
     }
 
     fprintf(_outFP, "\n");
@@ -1054,7 +1082,7 @@ void extSpef::writeNodeCoords(const uint netId, odb::dbSet<odb::dbRSeg>& rSet)
 
   for (odb::dbRSeg* rc : rSet) {
     const uint shapeId = rc->getShapeId();
-    if (!_foreign && shapeId == 0) {
+    if (!_write.foreign && shapeId == 0) {
       continue;
     }
 
@@ -1106,13 +1134,15 @@ void extSpef::writeRes(const uint netId, odb::dbSet<odb::dbRSeg>& rSet)
     writeCapNode(rc->getSourceNode(), netId);
     writeCapNode(rc->getTargetNode(), netId);
 
-    fprintf(
-        _outFP, "%g", rc->getResistance(_active_corner_number[0]) * _res_unit);
-    for (int ii = 1; ii < _active_corner_cnt; ii++) {
+    fprintf(_outFP,
+            "%g",
+            rc->getResistance(_write.active_corner_number[0])
+                * _res_unit);
+    for (int ii = 1; ii < _write.active_corner_cnt; ii++) {
       fprintf(_outFP,
               "%s%g",
               _delimiter,
-              rc->getResistance(_active_corner_number[ii]) * _res_unit);
+              rc->getResistance(_write.active_corner_number[ii]) * _res_unit);
     }
     fprintf(_outFP, " \n");
   }
@@ -1136,29 +1166,29 @@ void extSpef::writeNet(odb::dbNet* net, const double resBound, const uint debug)
     double totCap[ADS_MAX_CORNER];
     resetCap(totCap);
 
-    if (_symmetricCCcaps) {
+    if (_write.symmetric_cc_caps) {
       addCouplingCaps(net, totCap);
     } else {
       logger_->warn(RCX, 175, "Non-symmetric case feature is not implemented!");
     }
 
-    if (_preserveCapValues) {
+    if (_write.preserve_cap_values) {
       getCaps(net, totCap);
       writeDnet(netId, totCap);
 
-      if (_wConn) {
+      if (_write.conn) {
         writeKeyword("*CONN");
         writePorts(net);
         writeITerms(net);
       }
-      if (_writingNodeCoords == C_ON) {
+      if (_write.node_coords == C_ON) {
         writeNodeCoords(netId, rcSet);
       }
 
-      if (_wCap || _wOnlyCCcap) {
+      if (_write.cap || _write.only_cc_cap) {
         writeKeyword("*CAP");
       }
-      if (_wCap && !_wOnlyCCcap) {
+      if (_write.cap && !_write.only_cc_cap) {
         odb::dbSet<odb::dbCapNode> capSet = net->getCapNodes();
 
         writeCapPortsAndIterms(capSet, true);
@@ -1170,47 +1200,44 @@ void extSpef::writeNet(odb::dbNet* net, const double resBound, const uint debug)
 
       reinitCapTable(_nodeCapTable, capNodeCnt + 2);
 
-      if (_singleP) {
+      if (_write.single_pi) {
         computeCapsAdd2Target(rcSet, totCap);
       } else {
         computeCaps(rcSet, totCap);
       }
 
       writeDnet(netId, totCap);
-      if (_wConn) {
+      if (_write.conn) {
         writeKeyword("*CONN");
         writePorts(net);
         writeITerms(net);
       }
-      if (_writingNodeCoords == C_ON) {
+      if (_write.node_coords == C_ON) {
         writeNodeCoords(netId, rcSet);
       }
 
-      if (_wCap || _wOnlyCCcap) {
+      if (_write.cap || _write.only_cc_cap) {
         writeKeyword("*CAP");
       }
-      if (_wCap && !_wOnlyCCcap) {
+      if (_write.cap && !_write.only_cc_cap) {
         writeCapPorts(net);
         writeCapITerms(net);
         writeNodeCaps(net, netId);
       }
     }
-    if (_wCap || _wOnlyCCcap) {
+    if (_write.cap || _write.only_cc_cap) {
       writeSrcCouplingCaps(net);
     }
 
-    if (_symmetricCCcaps && (_wCap || _wOnlyCCcap)) {
+    if (_write.symmetric_cc_caps && (_write.cap || _write.only_cc_cap)) {
       writeTgtCouplingCaps(net);
     }
 
-    if (_wRes) {
+    if (_write.res) {
       writeRes(netId, rcSet);
     }
     writeKeyword("*END");
   }
-  for (odb::dbCapNode* node : net->getCapNodes()) {
-    node->setSortIndex(0);
-  }
 }
 
 bool extSpef::setInSpef(const char* filename, const bool onlyOpen)
@@ -1251,6 +1278,9 @@ bool extSpef::setOutSpef(const char* filename)
     fprintf(stderr, "Cannot open file %s with permissions \"w\"", filename);
     return false;
   }
+  // SPEF files are large; write them in big blocks rather than the default
+  // stdio buffer size.
+  setvbuf(_outFP, nullptr, _IOFBF, 1 << 20);
   return true;
 }
 
@@ -1297,7 +1327,7 @@ void extSpef::writeBlockPorts()
 
 uint extSpef::getNetMapId(const uint netId)
 {
-  _baseNameMap = std::max(_baseNameMap, netId);
+  _write.base_name_map = std::max(_write.base_name_map, netId);
 
   return netId;
 }
@@ -1335,13 +1365,13 @@ const char* extSpef::addEscChar(const char* iname, const bool esc_bus_brkts)
 
 const char* extSpef::tinkerSpefName(const char* iname)
 {
-  if (!_noBackSlash) {
+  if (!_write.no_back_slash) {
     return iname;
   }
   uint ii = 0;
   uint jj = 0;
   while (iname[ii] != '\0') {
-    if (_noBackSlash && iname[ii] == '\\')  // strip off backslash
+    if (_write.no_back_slash && iname[ii] == '\\')  // strip off backslash
     {
       ii++;
       continue;
@@ -1490,21 +1520,21 @@ void extSpef::writeBlock(const char* nodeCoord,
                          const bool parallel)
 {
   // _block is always the original block! even when #NEW_EXTRACTION_CORNER_DB
-  _wOnlyClock = wClock;
-  _wConn = wConn;
-  _wCap = wCap;
-  _wOnlyCCcap = wOnlyCCcap;
-  _wRes = wRes;
-  _noCnum = noCnum;
-  _noBackSlash = noBackSlash;
-  _foreign = _block->getExtControl()->_foreign;
-
-  _writingNodeCoords = C_NONE;
+  _write.only_clock = wClock;
+  _write.conn = wConn;
+  _write.cap = wCap;
+  _write.only_cc_cap = wOnlyCCcap;
+  _write.res = wRes;
+  _write.no_cnum = noCnum;
+  _write.no_back_slash = noBackSlash;
+  _write.foreign = _block->getExtControl()->_foreign;
+
+  _write.node_coords = C_NONE;
   if (nodeCoord && nodeCoord[0] != '\0') {
-    _writingNodeCoords = C_ON;
+    _write.node_coords = C_ON;
   }
   if (!wConn && !wCap && !wOnlyCCcap && !wRes) {
-    _wConn = _wCap = _wRes = true;
+    _write.conn = _write.cap = _write.res = true;
   }
 
   _partial = !tnets.empty();
@@ -1526,13 +1556,13 @@ void extSpef::writeBlock(const char* nodeCoord,
     }
     setCornerCnt(_block->getCornerCount());
 
-    if (!_preserveCapValues) {
+    if (!_write.preserve_cap_values) {
       setupMappingForWrite();
     }
 
     writeHeaderInfo();
 
-    if (_writeNameMap) {
+    if (_write.name_map) {
       writeKeyword("\n*NAME_MAP");
       odb::dbSet<odb::dbNet> nets = _block->getNets();
       writeNetMap(nets);
@@ -1558,11 +1588,10 @@ void extSpef::writeBlock(const char* nodeCoord,
   }
 
   _cornerBlock = nullptr;
-  _cornersPerBlock = _cornerCnt;
+  _write.corners_per_block = _cornerCnt;
   _cornerBlock = _block;
 
-  uint cnt = 0;
-
+  std::vector<odb::dbNet*> nets;
   for (odb::dbNet* net : _block->getNets()) {
     if (!tnets.empty() && !net->isMarked()) {
       if (!_incrPlusCcNets || net->getCcCount() == 0) {
@@ -1573,32 +1602,95 @@ void extSpef::writeBlock(const char* nodeCoord,
     if (type.isSupply()) {
       continue;
     }
-    if (_wOnlyClock && type != odb::dbSigType::CLOCK) {
+    if (_write.only_clock && type != odb::dbSigType::CLOCK) {
       continue;
     }
+    nets.push_back(net);
+  }
 
-    writeNet(net, 0.0, 0);
-    ++cnt;
+  writeNets(nets);
 
-    constexpr uint repChunk = 100000;
-    if (cnt % repChunk == 0) {
-      logger_->info(RCX, 42, "{} nets finished", cnt);
-    }
-  }
   for (odb::dbNet* net : tnets) {
     net->setMark(false);
   }
-  logger_->info(RCX, 443, "{} nets finished", cnt);
+  logger_->info(RCX, 443, "{} nets finished", nets.size());
 
   closeOutFile();
 }
 
+// Writing a net only reads the db, so chunks of nets are formatted
+// concurrently. Each thread formats a contiguous slice of the chunk into its
+// own memory stream and the streams are appended to the output in slice
+// order, so the file is the same as when it is written on one thread.
+void extSpef::writeNets(const std::vector<odb::dbNet*>& nets)
+{
+  constexpr int repChunk = 100000;
+  const int net_count = nets.size();
+  if (_threadCount == 1) {
+    for (int i = 0; i < net_count; i++) {
+      writeNet(nets[i], 0.0, 0);
+      if ((i + 1) % repChunk == 0) {
+        logger_->info(RCX, 42, "{} nets finished", i + 1);
+      }
+    }
+    return;
+  }
+
+  std::vector<std::unique_ptr<extSpef>> writers;
+  for (int t = 0; t < _threadCount; t++) {
+    writers.push_back(makeNetWriter());
+  }
+  constexpr int netsPerThread = 1024;
+  const int chunk_size = netsPerThread * _threadCount;
+  std::vector<char*> buffers(_threadCount);
+  std::vector<size_t> buffer_sizes(_threadCount);
+  for (int start = 0; start < net_count; start += chunk_size) {
+    const int end = std::min(start + chunk_size, net_count);
+#pragma omp parallel for num_threads(_threadCount) schedule(static, 1)
+    for (int t = 0; t < _threadCount; t++) {
+      extSpef* writer = writers[t].get();
+      writer->_outFP = open_memstream(&buffers[t], &buffer_sizes[t]);
+      const int slice = (end - start + _threadCount - 1) / _threadCount;
+      const int slice_end = std::min(start + (t + 1) * slice, end);
+      for (int i = start + t * slice; i < slice_end; i++) {
+        writer->writeNet(nets[i], 0.0, 0);
+      }
+      fclose(writer->_outFP);
+      writer->_outFP = nullptr;
+    }
+    for (int t = 0; t < _threadCount; t++) {
+      fwrite(buffers[t], 1, buffer_sizes[t], _outFP);
+      free(buffers[t]);
+    }
+    if (end / repChunk > start / repChunk) {
+      logger_->info(RCX, 42, "{} nets finished", end / repChunk * repChunk);
+    }
+  }
+}
+
+// A writer for formatting nets on another thread with the settings of this
+// one. It has its own scratch tables and output stream.
+std::unique_ptr<extSpef> extSpef::makeNetWriter()
+{
+  auto writer
+      = std::make_unique<extSpef>(_tech, _block, logger_, _version, _ext);
+  writer->_write = _write;
+  writer->_cornerBlock = _cornerBlock;
+  writer->_cornerCnt = _cornerCnt;
+  writer->_cap_unit = _cap_unit;
+  writer->_res_unit = _res_unit;
+  strcpy(writer->_delimiter, _delimiter);
+  writer->_nodeCapTable = new Ath__array1D<double*>(16000);
+  writer->initCapTable(writer->_nodeCapTable);
+  return writer;
+}
+
 void extSpef::write_spef_nets(const bool flatten, const bool parallel)
 {
-  _childBlockNetBaseMap = 0;
-  _childBlockInstBaseMap = 0;
+  _write.child_block_net_base_map = 0;
+  _write.child_block_inst_base_map = 0;
   _cornerBlock = _block;
-  _cornersPerBlock = _cornerCnt;
+  _write.corners_per_block = _cornerCnt;
 
   uint cnt = 0;
 
@@ -1607,7 +1699,7 @@ void extSpef::write_spef_nets(const bool flatten, const bool parallel)
     if (type.isSupply()) {
       continue;
     }
-    if (_wOnlyClock && type != odb::dbSigType::CLOCK) {
+    if (_write.only_clock && type != odb::dbSigType::CLOCK) {
       continue;
     }
 
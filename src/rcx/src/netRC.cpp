@@ -2073,8 +2073,8 @@ int extSpef::getWriteCorner(int corner, const char* names)
 {
   int cCnt = _block->getCornerCount();
   if ((corner >= 0) && (corner < cCnt)) {
-    _active_corner_cnt = 1;
-    _active_corner_number[0] = corner;
+    _write.active_corner_cnt = 1;
+    _write.active_corner_number[0] = corner;
     return corner;
   }
 
@@ -2089,14 +2089,14 @@ int extSpef::getWriteCorner(int corner, const char* names)
 
   if (names == nullptr || names[0] == '\0')  // all corners
   {
-    _active_corner_cnt = cCnt;
+    _write.active_corner_cnt = cCnt;
     for (int kk = 0; kk < cCnt; kk++) {
-      _active_corner_number[kk] = kk;
+      _write.active_corner_number[kk] = kk;
     }
     return -1;
   }
 
-  _active_corner_cnt = 0;
+  _write.active_corner_cnt = 0;
   int cn = 0;
   Ath__parser parser(logger_);
   parser.mkWords(names, nullptr);
@@ -2109,13 +2109,14 @@ int extSpef::getWriteCorner(int corner, const char* names)
                     parser.get(ii));
       continue;
     }
-    _active_corner_number[_active_corner_cnt++] = cn;
+    _write.active_corner_number[_write.active_corner_cnt++] = cn;
   }
   return cn;
 }
 
 void extMain::writeSPEF(char* filename,
                         char* netNames,
+                        uint netId,
                         bool noNameMap,
                         char* nodeCoord,
                         bool termJxy,
@@ -2146,10 +2147,11 @@ void extMain::writeSPEF(char* filename,
     delete _spef;
     _spef = new extSpef(_tech, _block, logger_, spef_version, this);
   }
-  _spef->_termJxy = termJxy;
+  _spef->_write.term_jxy = termJxy;
+  _spef->setThreadCount(_threadCount);
 
   _writeNameMap = noNameMap ? false : true;
-  _spef->_writeNameMap = _writeNameMap;
+  _spef->_write.name_map = _writeNameMap;
   _spef->setUseIdsFlag();
   int cntnet, cntrseg, cntcapn, cntcc;
   _block->getExtCount(cntnet, cntrseg, cntcapn, cntcc);
@@ -2184,6 +2186,14 @@ void extMain::writeSPEF(char* filename,
 
     std::vector<dbNet*> inets;
     ((dbBlock*) _block)->findSomeNet(netNames, inets);
+    if (netId > 0) {
+      dbNet* net = dbNet::getValidNet(_block, netId);
+      if (net == nullptr) {
+        logger_->warn(RCX, 498, "Can't find net with id {}.", netId);
+      } else {
+        inets.push_back(net);
+      }
+    }
     _spef->writeBlock(nodeCoord,
                       capUnit,
                       resUnit,
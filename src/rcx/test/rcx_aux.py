@@ -35,8 +35,10 @@ def extract_parasitics(
     )
 
 
-def write_spef(*, filename="", nets="", net_id=0, coordinates=False):
-    rcx.write_spef(filename, nets, net_id, coordinates)
+def write_spef(
+    *, filename="", nets="", net_id=0, coordinates=False, no_name_map=False
+):
+    rcx.write_spef(filename, nets, net_id, coordinates, no_name_map)
 
 
 def bench_verilog(*, filename=""):
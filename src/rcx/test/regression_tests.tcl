@@ -5,6 +5,8 @@ record_tests {
   gcd 
   45_gcd
   names
+  write_spef_threads
+  extract_threads
   #rcx_man_tcl_check
   #rcx_readme_msgs_check
 }
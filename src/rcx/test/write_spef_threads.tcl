@@ -0,0 +1,39 @@
+# write_spef on several threads matches the single threaded output
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+  -max_res 0 -coupling_threshold 0.1
+
+set net_id [[[ord::get_db_block] findNet _050_] getId]
+
+# Each option set is written on one and on two threads.
+set option_sets [list \
+  {} \
+  [list -nets "clk resp_val _050_"] \
+  [list -net_id $net_id] \
+  {-coordinates} \
+  {-no_name_map}]
+
+set test_index 0
+foreach options $option_sets {
+  incr test_index
+  set spef_files {}
+  foreach thread_count {1 2} {
+    set_thread_count $thread_count
+    set spef_file \
+      [make_result_file write_spef_threads$test_index-$thread_count.spef]
+    write_spef {*}$options $spef_file
+    lappend spef_files $spef_file
+  }
+  diff_files {*}$spef_files "^\\*(DATE|VERSION)"
+}
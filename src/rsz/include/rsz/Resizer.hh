@@ -53,6 +53,7 @@ class IncrementalGRoute;
 
 namespace stt {
 class SteinerTreeBuilder;
+struct SteinerNet;
 }
 
 namespace rsz {
@@ -290,7 +291,10 @@ class Resizer : public dbStaState
                    bool skip_pin_swap,
                    bool skip_gate_cloning,
                    bool skip_buffering,
-                   bool skip_buffer_removal);
+                   bool skip_buffer_removal,
+                   bool batch_upsizes);
+  // Upsizes applied by -batch_upsizes in the last repairSetup.
+  int repairSetupBatchUpsizeCount() const;
   // For testing.
   void repairSetup(const Pin* end_pin);
   // For testing.
@@ -582,9 +586,15 @@ class Resizer : public dbStaState
   void updateParasitics(bool save_guides = false);
   void ensureWireParasitic(const Pin* drvr_pin);
   void ensureWireParasitic(const Pin* drvr_pin, const Net* net);
+  void estimateWireParasitics(const vector<const Net*>& nets,
+                              SpefWriter* spef_writer);
+  bool needsWireParasitic(const Pin* drvr_pin, const Net* net);
   void estimateWireParasiticSteiner(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer);
+  void estimateWireParasiticSteiner(const Net* net,
+                                    SteinerTree* tree,
+                                    SpefWriter* spef_writer);
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -624,9 +634,20 @@ class Resizer : public dbStaState
                               bool revisiting_inst);
   // Returns nullptr if net has less than 2 pins or any pin is not placed.
   SteinerTree* makeSteinerTree(const Pin* drvr_pin);
+  // makeSteinerTree for each driver, built with the batched stt API.
+  // The result is indexed like drvr_pins, with nullptr for null drivers.
+  vector<SteinerTree*> makeSteinerTrees(const vector<const Pin*>& drvr_pins);
+  // Collect the pins of the driver's net into a tree without its branches.
+  // Returns nullptr if net has less than 2 pins or any pin is not placed.
+  SteinerTree* makeSteinerTreePins(const Pin* drvr_pin,
+                                   // Return value.
+                                   stt::SteinerNet& stt_net);
+  bool isSteinerTreeCurrent(SteinerTree* tree);
   BufferedNetPtr makeBufferedNet(const Pin* drvr_pin, const Corner* corner);
   BufferedNetPtr makeBufferedNetSteiner(const Pin* drvr_pin,
                                         const Corner* corner);
+  BufferedNetPtr makeBufferedNetSteiner(SteinerTree* tree,
+                                        const Corner* corner);
   BufferedNetPtr makeBufferedNetGroute(const Pin* drvr_pin,
                                        const Corner* corner);
   float bufferSlew(LibertyCell* buffer_cell,
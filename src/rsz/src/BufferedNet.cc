@@ -475,31 +475,40 @@ BufferedNetPtr Resizer::makeBufferedNetSteiner(const Pin* drvr_pin,
   BufferedNetPtr bnet = nullptr;
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    SteinerPt drvr_pt = tree->drvrPt();
-    if (drvr_pt != SteinerTree::null_pt) {
-      int branch_count = tree->branchCount();
-      SteinerPtAdjacents adjacents(branch_count);
-      for (int i = 0; i < branch_count; i++) {
-        stt::Branch& branch_pt = tree->branch(i);
-        SteinerPt j = branch_pt.n;
-        if (j != i) {
-          adjacents[i].push_back(j);
-          adjacents[j].push_back(i);
-        }
+    bnet = makeBufferedNetSteiner(tree, corner);
+    delete tree;
+  }
+  return bnet;
+}
+
+// Make BufferedNet from a steiner tree the caller owns.
+BufferedNetPtr Resizer::makeBufferedNetSteiner(SteinerTree* tree,
+                                               const Corner* corner)
+{
+  BufferedNetPtr bnet = nullptr;
+  SteinerPt drvr_pt = tree->drvrPt();
+  if (drvr_pt != SteinerTree::null_pt) {
+    int branch_count = tree->branchCount();
+    SteinerPtAdjacents adjacents(branch_count);
+    for (int i = 0; i < branch_count; i++) {
+      stt::Branch& branch_pt = tree->branch(i);
+      SteinerPt j = branch_pt.n;
+      if (j != i) {
+        adjacents[i].push_back(j);
+        adjacents[j].push_back(i);
       }
-      SteinerPtPinVisited pins_visited;
-      bnet = rsz::makeBufferedNetFromTree(tree,
-                                          SteinerTree::null_pt,
-                                          drvr_pt,
-                                          adjacents,
-                                          0,
-                                          pins_visited,
-                                          corner,
-                                          this,
-                                          logger_,
-                                          network_);
     }
-    delete tree;
+    SteinerPtPinVisited pins_visited;
+    bnet = rsz::makeBufferedNetFromTree(tree,
+                                        SteinerTree::null_pt,
+                                        drvr_pt,
+                                        adjacents,
+                                        0,
+                                        pins_visited,
+                                        corner,
+                                        this,
+                                        logger_,
+                                        network_);
   }
   return bnet;
 }
@@ -338,12 +338,13 @@ void Resizer::incrementalParasiticsEnd()
 void Resizer::updateParasitics(bool save_guides)
 {
   switch (parasitics_src_) {
-    case ParasiticsSrc::placement:
-      for (const Net* net : parasitics_invalid_) {
-        estimateWireParasitic(net);
-      }
+    case ParasiticsSrc::placement: {
+      const vector<const Net*> nets(parasitics_invalid_.begin(),
+                                    parasitics_invalid_.end());
+      estimateWireParasitics(nets, nullptr);
       parasitics_invalid_.clear();
       break;
+    }
     case ParasiticsSrc::global_routing: {
       incr_groute_->updateRoutes(save_guides);
       for (const Net* net : parasitics_invalid_) {
@@ -407,18 +408,58 @@ void Resizer::estimateWireParasitics(SpefWriter* spef_writer)
     // Make separate parasitics for each corner, same for min/max.
     sta_->setParasiticAnalysisPts(true);
 
+    vector<const Net*> nets;
     NetIterator* net_iter = network_->netIterator(network_->topInstance());
     while (net_iter->hasNext()) {
-      Net* net = net_iter->next();
-      estimateWireParasitic(net, spef_writer);
+      nets.push_back(net_iter->next());
     }
     delete net_iter;
+    estimateWireParasitics(nets, spef_writer);
 
     parasitics_src_ = ParasiticsSrc::placement;
     parasitics_invalid_.clear();
   }
 }
 
+// Steiner trees only read the network so they are built concurrently.
+// Parasitics and the delay calculator are not thread safe so the trees are
+// turned into parasitics serially, in net order.
+void Resizer::estimateWireParasitics(const vector<const Net*>& nets,
+                                     SpefWriter* spef_writer)
+{
+  const int net_count = nets.size();
+  vector<const Pin*> drvr_pins(net_count, nullptr);
+  vector<bool> is_pad_net(net_count, false);
+  for (int i = 0; i < net_count; i++) {
+    const Net* net = nets[i];
+    PinSet* drivers = network_->drivers(net);
+    if (drivers && !drivers->empty()) {
+      PinSet::Iterator drvr_iter(drivers);
+      const Pin* drvr_pin = drvr_iter.next();
+      if (needsWireParasitic(drvr_pin, net)) {
+        drvr_pins[i] = drvr_pin;
+        is_pad_net[i] = isPadNet(net);
+      }
+    }
+  }
+
+  vector<const Pin*> tree_drvr_pins(net_count, nullptr);
+  for (int i = 0; i < net_count; i++) {
+    if (!is_pad_net[i]) {
+      tree_drvr_pins[i] = drvr_pins[i];
+    }
+  }
+  const vector<SteinerTree*> trees = makeSteinerTrees(tree_drvr_pins);
+
+  for (int i = 0; i < net_count; i++) {
+    if (is_pad_net[i]) {
+      makePadParasitic(nets[i], spef_writer);
+    } else if (trees[i]) {
+      estimateWireParasiticSteiner(nets[i], trees[i], spef_writer);
+    }
+  }
+}
+
 void Resizer::estimateWireParasitic(const Net* net, SpefWriter* spef_writer)
 {
   PinSet* drivers = network_->drivers(net);
@@ -433,9 +474,7 @@ void Resizer::estimateWireParasitic(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer)
 {
-  if (!network_->isPower(net) && !network_->isGround(net)
-      && !sta_->isIdealClock(drvr_pin)
-      && !db_network_->staToDb(net)->isSpecial()) {
+  if (needsWireParasitic(drvr_pin, net)) {
     if (isPadNet(net)) {
       // When an input port drives a pad instance with huge input
       // cap the elmore delay is gigantic. Annotate with zero
@@ -447,6 +486,13 @@ void Resizer::estimateWireParasitic(const Pin* drvr_pin,
   }
 }
 
+bool Resizer::needsWireParasitic(const Pin* drvr_pin, const Net* net)
+{
+  return !network_->isPower(net) && !network_->isGround(net)
+         && !sta_->isIdealClock(drvr_pin)
+         && !db_network_->staToDb(net)->isSpecial();
+}
+
 bool Resizer::isPadNet(const Net* net) const
 {
   const Pin *pin1, *pin2;
@@ -487,89 +533,97 @@ void Resizer::estimateWireParasiticSteiner(const Pin* drvr_pin,
 {
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    debugPrint(logger_,
-               RSZ,
-               "resizer_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (Corner* corner : *sta_->corners()) {
-      const ParasiticAnalysisPt* parasitics_ap
-          = corner->findParasiticAnalysisPt(max_);
-      Parasitic* parasitic
-          = sta_->makeParasiticNetwork(net, false, parasitics_ap);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      int branch_count = tree->branchCount();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        ParasiticNode* n1 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        ParasiticNode* n2 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+    estimateWireParasiticSteiner(net, tree, spef_writer);
+  }
+}
+
+// Takes ownership of tree.
+void Resizer::estimateWireParasiticSteiner(const Net* net,
+                                           SteinerTree* tree,
+                                           SpefWriter* spef_writer)
+{
+  debugPrint(logger_,
+             RSZ,
+             "resizer_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+  for (Corner* corner : *sta_->corners()) {
+    const ParasiticAnalysisPt* parasitics_ap
+        = corner->findParasiticAnalysisPt(max_);
+    Parasitic* parasitic
+        = sta_->makeParasiticNetwork(net, false, parasitics_ap);
+    bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    int branch_count = tree->branchCount();
+    size_t resistor_id = 1;
+    for (int i = 0; i < branch_count; i++) {
+      Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
         } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     RSZ,
-                     "resizer_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics_->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics_->name(n2));
-          parasitics_->incrCap(n1, cap / 2.0);
-          parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics_->incrCap(n2, cap / 2.0);
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
-        parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      if (spef_writer) {
-        spef_writer->writeNet(corner, net, parasitic);
+      ParasiticNode* n1 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt1, network_);
+      ParasiticNode* n2 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt2, network_);
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap;
+        double res = length * wire_res;
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   RSZ,
+                   "resizer_parasitics",
+                   2,
+                   " pi {} l={} c2={} rpi={} c1={} {}",
+                   parasitics_->name(n1),
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   parasitics_->name(n2));
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
+        parasitics_->incrCap(n2, cap / 2.0);
       }
-      arc_delay_calc_->reduceParasitic(
-          parasitic, net, corner, sta::MinMaxAll::all());
+      parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
+      parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
     }
-    parasitics_->deleteParasiticNetworks(net);
-    delete tree;
+    if (spef_writer) {
+      spef_writer->writeNet(corner, net, parasitic);
+    }
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, sta::MinMaxAll::all());
   }
+  parasitics_->deleteParasiticNetworks(net);
+  delete tree;
 }
 
 float Resizer::pinCapacitance(const Pin* pin,
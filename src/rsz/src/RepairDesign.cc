@@ -36,6 +36,7 @@
 #include "RepairDesign.hh"
 
 #include "BufferedNet.hh"
+#include "SteinerTree.hh"
 #include "db_sta/dbNetwork.hh"
 #include "rsz/Resizer.hh"
 #include "sta/Corner.hh"
@@ -198,7 +199,11 @@ void RepairDesign::repairDesign(
     printProgress(print_iteration, false, false, repaired_net_count);
   }
   int max_length = resizer_->metersToDbu(max_wire_length);
-  for (int i = resizer_->level_drvr_vertices_.size() - 1; i >= 0; i--) {
+  const int drvr_count = resizer_->level_drvr_vertices_.size();
+  for (int i = drvr_count - 1; i >= 0; i--) {
+    if ((drvr_count - 1 - i) % steiner_tree_batch_size_ == 0) {
+      makeSteinerTrees(max(i - steiner_tree_batch_size_ + 1, 0), i);
+    }
     print_iteration++;
     if (verbose) {
       printProgress(print_iteration, false, false, repaired_net_count);
@@ -250,6 +255,7 @@ void RepairDesign::repairDesign(
       }
     }
   }
+  deleteSteinerTrees();
   resizer_->updateParasitics();
   if (verbose) {
     printProgress(print_iteration, true, true, repaired_net_count);
@@ -711,7 +717,7 @@ void RepairDesign::repairNet(Net* net,
     }
     // For tristate nets all we can do is resize the driver.
     if (!resizer_->isTristateDriver(drvr_pin)) {
-      BufferedNetPtr bnet = resizer_->makeBufferedNetSteiner(drvr_pin, corner);
+      BufferedNetPtr bnet = makeBufferedNetSteiner(drvr_pin, corner);
       if (bnet) {
         resizer_->ensureWireParasitic(drvr_pin, net);
         graph_delay_calc_->findDelays(drvr);
@@ -774,6 +780,62 @@ void RepairDesign::repairNet(Net* net,
   }
 }
 
+// Steiner trees only read the network so the trees for the next batch of
+// drivers in the repair loop are built concurrently. Repairing a net can
+// move or reconnect the pins of nets later in the loop, so a tree is only
+// used if its net is unchanged when the loop reaches it.
+void RepairDesign::makeSteinerTrees(const int first_index, const int last_index)
+{
+  deleteSteinerTrees();
+  vector<const Pin*> drvr_pins;
+  for (int i = last_index; i >= first_index; i--) {
+    Vertex* drvr = resizer_->level_drvr_vertices_[i];
+    const Pin* drvr_pin = drvr->pin();
+    Net* net = network_->isTopLevelPort(drvr_pin)
+                   ? network_->net(network_->term(drvr_pin))
+                   : network_->net(drvr_pin);
+    if (net && !resizer_->dontTouch(net)
+        && !db_network_->staToDb(net)->isConnectedByAbutment()
+        && !sta_->isClock(drvr_pin) && !drvr->isConstant()
+        && !db_network_->isSpecial(net)
+        && !resizer_->isTristateDriver(drvr_pin)) {
+      drvr_pins.push_back(drvr_pin);
+    }
+  }
+
+  const vector<SteinerTree*> trees = resizer_->makeSteinerTrees(drvr_pins);
+  for (int i = 0; i < drvr_pins.size(); i++) {
+    if (trees[i]) {
+      steiner_trees_[drvr_pins[i]] = trees[i];
+    }
+  }
+}
+
+void RepairDesign::deleteSteinerTrees()
+{
+  for (auto& [drvr_pin, tree] : steiner_trees_) {
+    delete tree;
+  }
+  steiner_trees_.clear();
+}
+
+BufferedNetPtr RepairDesign::makeBufferedNetSteiner(const Pin* drvr_pin,
+                                                    const Corner* corner)
+{
+  auto tree_iter = steiner_trees_.find(drvr_pin);
+  if (tree_iter != steiner_trees_.end()) {
+    SteinerTree* tree = tree_iter->second;
+    steiner_trees_.erase(tree_iter);
+    if (resizer_->isSteinerTreeCurrent(tree)) {
+      BufferedNetPtr bnet = resizer_->makeBufferedNetSteiner(tree, corner);
+      delete tree;
+      return bnet;
+    }
+    delete tree;
+  }
+  return resizer_->makeBufferedNetSteiner(drvr_pin, corner);
+}
+
 bool RepairDesign::needRepairSlew(const Pin* drvr_pin,
                                   int& slew_violations,
                                   float& max_cap,
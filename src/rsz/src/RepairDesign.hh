@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "BufferedNet.hh"
 #include "PreChecks.hh"
 #include "db_sta/dbSta.hh"
@@ -49,6 +51,7 @@
 namespace rsz {
 
 class Resizer;
+class SteinerTree;
 enum class ParasiticsSrc;
 
 using std::vector;
@@ -114,6 +117,10 @@ class RepairDesign : dbStaState
   bool getCin(const Pin* drvr_pin, float& cin);
   void findBufferSizes();
   bool performGainBuffering(Net* net, const Pin* drvr_pin, int max_fanout);
+  void makeSteinerTrees(int first_index, int last_index);
+  void deleteSteinerTrees();
+  BufferedNetPtr makeBufferedNetSteiner(const Pin* drvr_pin,
+                                        const Corner* corner);
 
   void repairNet(Net* net,
                  const Pin* drvr_pin,
@@ -257,6 +264,8 @@ class RepairDesign : dbStaState
 
   // Gain buffering
   std::vector<LibertyCell*> buffer_sizes_;
+  // Steiner trees built ahead of the repair loop, by driver pin.
+  std::unordered_map<const Pin*, SteinerTree*> steiner_trees_;
 
   // Implicit arguments to repairNet bnet recursion.
   const Pin* drvr_pin_ = nullptr;
@@ -278,6 +287,7 @@ class RepairDesign : dbStaState
   static constexpr float elmore_skew_factor_ = 1.39;
   static constexpr int min_print_interval_ = 10;
   static constexpr int max_print_interval_ = 100;
+  static constexpr int steiner_tree_batch_size_ = 4096;
 };
 
 }  // namespace rsz
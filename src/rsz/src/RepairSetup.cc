@@ -35,6 +35,8 @@
 
 #include "RepairSetup.hh"
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
 
 #include "rsz/Resizer.hh"
@@ -93,13 +95,15 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
                               const bool skip_pin_swap,
                               const bool skip_gate_cloning,
                               const bool skip_buffering,
-                              const bool skip_buffer_removal)
+                              const bool skip_buffer_removal,
+                              const bool batch_upsizes)
 {
   init();
   constexpr int digits = 3;
   inserted_buffer_count_ = 0;
   split_load_buffer_count_ = 0;
   resize_count_ = 0;
+  batch_resize_count_ = 0;
   cloned_gate_count_ = 0;
   swap_pin_count_ = 0;
   removed_buffer_count_ = 0;
@@ -262,6 +266,7 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
                                       skip_gate_cloning,
                                       skip_buffering,
                                       skip_buffer_removal,
+                                      batch_upsizes,
                                       setup_slack_margin);
       if (!changed) {
         if (pass != 1) {
@@ -405,6 +410,10 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
   if (resize_count_ > 0) {
     logger_->info(RSZ, 41, "Resized {} instances.", resize_count_);
   }
+  if (batch_resize_count_ > 0) {
+    logger_->info(
+        RSZ, 144, "Batch upsized {} instances.", batch_resize_count_);
+  }
   if (swap_pin_count_ > 0) {
     logger_->info(RSZ, 43, "Swapped pins on {} instances.", swap_pin_count_);
   }
@@ -434,7 +443,7 @@ void RepairSetup::repairSetup(const Pin* end_pin)
   const Slack slack = sta_->vertexSlack(vertex, max_);
   PathRef path = sta_->vertexWorstSlackPath(vertex, max_);
   resizer_->incrementalParasiticsBegin();
-  repairPath(path, slack, false, false, false, false, 0.0);
+  repairPath(path, slack, false, false, false, false, false, 0.0);
   // Leave the parasitices up to date.
   resizer_->updateParasitics();
   resizer_->incrementalParasiticsEnd();
@@ -477,6 +486,7 @@ bool RepairSetup::repairPath(PathRef& path,
                              const bool skip_gate_cloning,
                              const bool skip_buffering,
                              const bool skip_buffer_removal,
+                             const bool batch_upsizes,
                              const float setup_slack_margin)
 {
   PathExpanded expanded(&path, sta_);
@@ -552,6 +562,9 @@ bool RepairSetup::repairPath(PathRef& path,
       }
 
       if (upsizeDrvr(drvr_path, drvr_index, &expanded)) {
+        if (batch_upsizes) {
+          upsizeBatch(&expanded, load_delays, drvr_index, path_slack);
+        }
         changed = true;
         break;
       }
@@ -1097,6 +1110,209 @@ bool RepairSetup::upsizeDrvr(PathRef* drvr_path,
   return false;
 }
 
+// Find the stages on the path other than skip_drvr_index that upsizeDrvr
+// would resize and estimate the path delay improvement of each from the
+// cached slews and slacks.
+vector<UpsizeMove> RepairSetup::estimateUpsizes(
+    PathExpanded* expanded,
+    const vector<pair<int, Delay>>& load_delays,
+    const int skip_drvr_index,
+    const Slack path_slack)
+{
+  vector<UpsizeMove> moves;
+  for (const auto& [drvr_index, ignored] : load_delays) {
+    if (drvr_index == skip_drvr_index) {
+      continue;
+    }
+    PathRef* drvr_path = expanded->path(drvr_index);
+    Pin* drvr_pin = drvr_path->pin(this);
+    Instance* drvr = network_->instance(drvr_pin);
+    if (resizer_->dontTouch(drvr)) {
+      continue;
+    }
+    const DcalcAnalysisPt* dcalc_ap = drvr_path->dcalcAnalysisPt(sta_);
+    const float load_cap = graph_delay_calc_->loadCap(drvr_pin, dcalc_ap);
+    Pin* in_pin = expanded->path(drvr_index - 1)->pin(sta_);
+    LibertyPort* in_port = network_->libertyPort(in_pin);
+    LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
+    if (in_port == nullptr || drvr_port == nullptr) {
+      continue;
+    }
+    float prev_drive = 0.0;
+    if (drvr_index >= 2) {
+      Pin* prev_drvr_pin = expanded->path(drvr_index - 2)->pin(sta_);
+      LibertyPort* prev_drvr_port = network_->libertyPort(prev_drvr_pin);
+      if (prev_drvr_port) {
+        prev_drive = prev_drvr_port->driveResistance();
+      }
+    }
+    LibertyCell* upsize
+        = upsizeCell(in_port, drvr_port, load_cap, prev_drive, dcalc_ap);
+    float gain;
+    if (upsize
+        && estimateUpsizeGain(expanded, drvr_index, upsize, path_slack, gain)) {
+      moves.push_back({drvr_index, drvr, upsize, gain});
+    }
+  }
+  sort(moves.begin(), moves.end(), [](const auto& move1, const auto& move2) {
+    return move1.gain > move2.gain;
+  });
+  return moves;
+}
+
+// Estimate the path delay change from swapping the driver at drvr_index
+// to upsize. The stage delay improvement is offset by the degradation of
+// the previous driver from the larger input pin capacitance, which the
+// side fanouts of the previous driver also see. Returns false if the move
+// does not improve the path or would make a side fanout the new worst path.
+bool RepairSetup::estimateUpsizeGain(PathExpanded* expanded,
+                                     const int drvr_index,
+                                     LibertyCell* upsize,
+                                     const Slack path_slack,
+                                     // Return value.
+                                     float& gain)
+{
+  PathRef* drvr_path = expanded->path(drvr_index);
+  PathRef* in_path = expanded->path(drvr_index - 1);
+  const Pin* drvr_pin = drvr_path->pin(sta_);
+  const Pin* in_pin = in_path->pin(sta_);
+  LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
+  LibertyPort* in_port = network_->libertyPort(in_pin);
+  LibertyPort* upsize_drvr = upsize->findLibertyPort(drvr_port->name());
+  LibertyPort* upsize_input = upsize->findLibertyPort(in_port->name());
+  if (upsize_drvr == nullptr || upsize_input == nullptr) {
+    return false;
+  }
+  const DcalcAnalysisPt* dcalc_ap = drvr_path->dcalcAnalysisPt(sta_);
+  const Corner* corner = dcalc_ap->corner();
+  const int rf_index = drvr_path->transition(sta_)->index();
+
+  Vertex* in_vertex = in_path->vertex(sta_);
+  Slew in_slews[RiseFall::index_count];
+  for (const RiseFall* rf : RiseFall::range()) {
+    in_slews[rf->index()] = sta_->vertexSlew(in_vertex, rf, dcalc_ap);
+  }
+  const float load_cap = graph_delay_calc_->loadCap(drvr_pin, dcalc_ap);
+  ArcDelay old_delay[RiseFall::index_count], new_delay[RiseFall::index_count];
+  Slew old_slew[RiseFall::index_count], new_slew[RiseFall::index_count];
+  resizer_->gateDelays(
+      drvr_port, load_cap, in_slews, dcalc_ap, old_delay, old_slew);
+  resizer_->gateDelays(
+      upsize_drvr, load_cap, in_slews, dcalc_ap, new_delay, new_slew);
+  gain = old_delay[rf_index] - new_delay[rf_index];
+
+  if (drvr_index >= 2) {
+    PathRef* prev_drvr_path = expanded->path(drvr_index - 2);
+    const Pin* prev_drvr_pin = prev_drvr_path->pin(sta_);
+    LibertyPort* prev_drvr_port = network_->libertyPort(prev_drvr_pin);
+    if (prev_drvr_port) {
+      const float prev_cap
+          = graph_delay_calc_->loadCap(prev_drvr_pin, dcalc_ap);
+      const float cap_delta = resizer_->portCapacitance(upsize_input, corner)
+                              - resizer_->portCapacitance(in_port, corner);
+      resizer_->annotateInputSlews(network_->instance(prev_drvr_pin),
+                                   dcalc_ap);
+      resizer_->gateDelays(
+          prev_drvr_port, prev_cap, dcalc_ap, old_delay, old_slew);
+      resizer_->gateDelays(
+          prev_drvr_port, prev_cap + cap_delta, dcalc_ap, new_delay, new_slew);
+      resizer_->resetInputSlews();
+      const float delay_degrad
+          = new_delay[prev_drvr_path->transition(sta_)->index()]
+            - old_delay[prev_drvr_path->transition(sta_)->index()];
+      gain -= delay_degrad;
+
+      if (delay_degrad > 0.0) {
+        Net* prev_net = network_->net(prev_drvr_pin);
+        std::unique_ptr<NetConnectedPinIterator> pin_iter(
+            network_->connectedPinIterator(prev_net));
+        while (pin_iter->hasNext()) {
+          const Pin* side_pin = pin_iter->next();
+          if (side_pin == prev_drvr_pin || side_pin == in_pin) {
+            continue;
+          }
+          const Slack side_slack = sta_->pinSlack(side_pin, max_);
+          if (fuzzyLess(side_slack - delay_degrad, path_slack)) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+  debugPrint(logger_,
+             RSZ,
+             "repair_setup",
+             4,
+             "estimate resize {} {} -> {} gain {}",
+             network_->pathName(drvr_pin),
+             drvr_port->libertyCell()->name(),
+             upsize->name(),
+             delayAsString(gain, sta_, 3));
+  return fuzzyGreater(gain, 0.0);
+}
+
+// After upsizeDrvr resized the driver at first_drvr_index, also apply the
+// estimated upsizes of other stages on the path. A move is skipped if any
+// net connected to its instance is connected to an instance already
+// resized in this pass, since its estimated input slew, load cap or
+// previous driver delay would be stale. Slew changes that propagate
+// further downstream are not modeled; the timing update after the pass
+// covers them.
+int RepairSetup::upsizeBatch(PathExpanded* expanded,
+                             const vector<pair<int, Delay>>& load_delays,
+                             const int first_drvr_index,
+                             const Slack path_slack)
+{
+  const vector<UpsizeMove> moves
+      = estimateUpsizes(expanded, load_delays, first_drvr_index, path_slack);
+  if (moves.empty()) {
+    return 0;
+  }
+  std::unordered_set<const Net*> resized_nets;
+  const Pin* first_drvr_pin = expanded->path(first_drvr_index)->pin(sta_);
+  instanceNets(network_->instance(first_drvr_pin), resized_nets);
+  int count = 0;
+  for (const UpsizeMove& move : moves) {
+    std::unordered_set<const Net*> move_nets;
+    instanceNets(move.drvr, move_nets);
+    const bool overlaps
+        = std::any_of(move_nets.begin(), move_nets.end(), [&](const Net* net) {
+            return resized_nets.find(net) != resized_nets.end();
+          });
+    if (overlaps) {
+      continue;
+    }
+    debugPrint(logger_,
+               RSZ,
+               "repair_setup",
+               3,
+               "batch resize {} -> {} gain {}",
+               network_->pathName(move.drvr),
+               move.cell->name(),
+               delayAsString(move.gain, sta_, 3));
+    if (resizer_->replaceCell(move.drvr, move.cell, true)) {
+      resized_nets.insert(move_nets.begin(), move_nets.end());
+      resize_count_++;
+      batch_resize_count_++;
+      count++;
+    }
+  }
+  return count;
+}
+
+void RepairSetup::instanceNets(const Instance* inst,
+                               // Return value.
+                               std::unordered_set<const Net*>& nets)
+{
+  std::unique_ptr<InstancePinIterator> pin_iter{network_->pinIterator(inst)};
+  while (pin_iter->hasNext()) {
+    const Net* net = network_->net(pin_iter->next());
+    if (net) {
+      nets.insert(net);
+    }
+  }
+}
+
 LibertyCell* RepairSetup::upsizeCell(LibertyPort* in_port,
                                      LibertyPort* drvr_port,
                                      const float load_cap,
@@ -1818,6 +2034,7 @@ void RepairSetup::repairSetupLastGasp(const OptoParams& params, int& num_viols)
                                       true /* skip_gate_cloning */,
                                       true /* skip_buffering */,
                                       true /* skip_buffer_removal */,
+                                      false /* batch_upsizes */,
                                       params.setup_slack_margin);
 
       if (!changed) {
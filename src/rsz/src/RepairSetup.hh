@@ -105,6 +105,15 @@ struct SlackEstimatorParams
     driver_cell = nullptr;
   }
 };
+// What-if estimate for resizing one driver on a repaired path.
+struct UpsizeMove
+{
+  int drvr_index;
+  Instance* drvr;
+  LibertyCell* cell;
+  // Estimated path delay improvement.
+  float gain;
+};
 struct OptoParams
 {
   int iteration;
@@ -133,8 +142,12 @@ class RepairSetup : public sta::dbStaState
                    bool skip_pin_swap,
                    bool skip_gate_cloning,
                    bool skip_buffering,
-                   bool skip_buffer_removal);
+                   bool skip_buffer_removal,
+                   bool batch_upsizes);
   // For testing.
+  // Upsizes applied by the batch path, including any later undone by a
+  // journal restore.
+  int batchUpsizeCount() const { return batch_resize_count_; }
   void repairSetup(const Pin* end_pin);
   // For testing.
   void reportSwappablePins();
@@ -150,6 +163,7 @@ class RepairSetup : public sta::dbStaState
                   bool skip_gate_cloning,
                   bool skip_buffering,
                   bool skip_buffer_removal,
+                  bool batch_upsizes,
                   float setup_slack_margin);
   void debugCheckMultipleBuffers(PathRef& path, PathExpanded* expanded);
   bool simulateExpr(
@@ -182,6 +196,24 @@ class RepairSetup : public sta::dbStaState
                                SlackEstimatorParams params,
                                bool accept_if_slack_improves);
   bool upsizeDrvr(PathRef* drvr_path, int drvr_index, PathExpanded* expanded);
+  vector<UpsizeMove> estimateUpsizes(
+      PathExpanded* expanded,
+      const vector<pair<int, sta::Delay>>& load_delays,
+      int skip_drvr_index,
+      Slack path_slack);
+  bool estimateUpsizeGain(PathExpanded* expanded,
+                          int drvr_index,
+                          LibertyCell* upsize,
+                          Slack path_slack,
+                          // Return value.
+                          float& gain);
+  int upsizeBatch(PathExpanded* expanded,
+                  const vector<pair<int, sta::Delay>>& load_delays,
+                  int first_drvr_index,
+                  Slack path_slack);
+  void instanceNets(const Instance* inst,
+                    // Return value.
+                    std::unordered_set<const Net*>& nets);
   Point computeCloneGateLocation(
       const Pin* drvr_pin,
       const vector<pair<Vertex*, Slack>>& fanout_slacks);
@@ -232,6 +264,7 @@ class RepairSetup : public sta::dbStaState
   LibertyPort* drvr_port_ = nullptr;
 
   int resize_count_ = 0;
+  int batch_resize_count_ = 0;
   int inserted_buffer_count_ = 0;
   int split_load_buffer_count_ = 0;
   int rebuffer_net_count_ = 0;
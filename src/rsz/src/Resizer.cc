@@ -2775,7 +2775,8 @@ void Resizer::repairSetup(double setup_margin,
                           bool skip_pin_swap,
                           bool skip_gate_cloning,
                           bool skip_buffering,
-                          bool skip_buffer_removal)
+                          bool skip_buffer_removal,
+                          bool batch_upsizes)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
@@ -2788,7 +2789,8 @@ void Resizer::repairSetup(double setup_margin,
                              skip_pin_swap,
                              skip_gate_cloning,
                              skip_buffering,
-                             skip_buffer_removal);
+                             skip_buffer_removal,
+                             batch_upsizes);
 }
 
 void Resizer::reportSwappablePins()
@@ -2797,6 +2799,11 @@ void Resizer::reportSwappablePins()
   repair_setup_->reportSwappablePins();
 }
 
+int Resizer::repairSetupBatchUpsizeCount() const
+{
+  return repair_setup_->batchUpsizeCount();
+}
+
 void Resizer::repairSetup(const Pin* end_pin)
 {
   resizePreamble();
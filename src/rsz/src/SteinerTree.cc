@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "AbstractSteinerRenderer.h"
 #include "db_sta/dbNetwork.hh"
@@ -60,9 +61,58 @@ static void connectedPins(const Net* net,
                           dbNetwork* db_network,
                           // Return value.
                           Vector<PinLoc>& pins);
+static void sortPinLocs(Vector<PinLoc>& pinlocs);
 
 // Returns nullptr if net has less than 2 pins or any pin is not placed.
 SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
+{
+  stt::SteinerNet stt_net;
+  SteinerTree* tree = makeSteinerTreePins(drvr_pin, stt_net);
+  if (tree) {
+    stt::Tree ftree = stt_builder_->makeSteinerTree(
+        stt_net.net, stt_net.x, stt_net.y, stt_net.drvr_index);
+    tree->setTree(ftree, db_network_);
+    tree->createSteinerPtToPinMap();
+  }
+  return tree;
+}
+
+// Null drivers get a null tree. Collecting the pins only reads the network
+// so it is done concurrently, as are the trees in stt.
+vector<SteinerTree*> Resizer::makeSteinerTrees(
+    const vector<const Pin*>& drvr_pins)
+{
+  const int drvr_pin_count = drvr_pins.size();
+  vector<SteinerTree*> trees(drvr_pin_count, nullptr);
+  vector<stt::SteinerNet> stt_nets(drvr_pin_count);
+#pragma omp parallel for num_threads(sta_->threadCount()) schedule(dynamic, 64)
+  for (int i = 0; i < drvr_pin_count; i++) {
+    if (drvr_pins[i]) {
+      trees[i] = makeSteinerTreePins(drvr_pins[i], stt_nets[i]);
+    }
+  }
+
+  vector<int> tree_indices;
+  vector<stt::SteinerNet> placed_nets;
+  for (int i = 0; i < drvr_pin_count; i++) {
+    if (trees[i]) {
+      tree_indices.push_back(i);
+      placed_nets.push_back(std::move(stt_nets[i]));
+    }
+  }
+  const vector<stt::Tree> ftrees
+      = stt_builder_->makeSteinerTrees(placed_nets, sta_->threadCount());
+  for (int j = 0; j < tree_indices.size(); j++) {
+    SteinerTree* tree = trees[tree_indices[j]];
+    tree->setTree(ftrees[j], db_network_);
+    tree->createSteinerPtToPinMap();
+  }
+  return trees;
+}
+
+SteinerTree* Resizer::makeSteinerTreePins(const Pin* drvr_pin,
+                                          // Return value.
+                                          stt::SteinerNet& stt_net)
 {
   Network* sdc_network = network_->sdcNetwork();
   Net* net = network_->isTopLevelPort(drvr_pin)
@@ -73,24 +123,20 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
   Vector<PinLoc>& pinlocs = tree->pinlocs();
   // Find all the connected pins
   connectedPins(net, network_, db_network_, pinlocs);
-  // Sort pins by location because connectedPins order is not deterministic.
-  sort(pinlocs, [=](const PinLoc& pin1, const PinLoc& pin2) {
-    return pin1.loc.getX() < pin2.loc.getX()
-           || (pin1.loc.getX() == pin2.loc.getX()
-               && pin1.loc.getY() < pin2.loc.getY());
-  });
+  sortPinLocs(pinlocs);
   int pin_count = pinlocs.size();
   bool is_placed = true;
   if (pin_count >= 2) {
-    vector<int> x, y;  // Two separate vectors of coordinates needed by flute.
-    int drvr_idx = 0;  // The "driver_pin" or the root of the Steiner tree.
+    // Two separate vectors of coordinates needed by flute.
+    stt_net.net = db_network_->staToDb(net);
+    stt_net.drvr_index = 0;  // The "driver_pin" or the root of the tree.
     for (int i = 0; i < pin_count; i++) {
       const PinLoc& pinloc = pinlocs[i];
       if (pinloc.pin == drvr_pin) {
-        drvr_idx = i;  // drvr_index is needed by flute.
+        stt_net.drvr_index = i;  // drvr_index is needed by flute.
       }
-      x.push_back(pinloc.loc.x());
-      y.push_back(pinloc.loc.y());
+      stt_net.x.push_back(pinloc.loc.x());
+      stt_net.y.push_back(pinloc.loc.y());
       debugPrint(logger_,
                  RSZ,
                  "steiner",
@@ -108,11 +154,6 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
       tree->locAddPin(pinloc.loc, pinloc.pin);
     }
     if (is_placed) {
-      stt::Tree ftree = stt_builder_->makeSteinerTree(
-          db_network_->staToDb(net), x, y, drvr_idx);
-
-      tree->setTree(ftree, db_network_);
-      tree->createSteinerPtToPinMap();
       return tree;
     }
   }
@@ -120,6 +161,43 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
   return nullptr;
 }
 
+// True if the driver net still has the pins and pin locations the tree
+// was built from, so a tree made ahead of time can still be used.
+bool Resizer::isSteinerTreeCurrent(SteinerTree* tree)
+{
+  const Pin* drvr_pin = tree->drvr_pin_;
+  Net* net = network_->isTopLevelPort(drvr_pin)
+                 ? network_->net(network_->term(drvr_pin))
+                 : network_->net(drvr_pin);
+  if (net == nullptr) {
+    return false;
+  }
+  Vector<PinLoc> pinlocs;
+  connectedPins(net, network_, db_network_, pinlocs);
+  const Vector<PinLoc>& tree_pinlocs = tree->pinlocs();
+  if (pinlocs.size() != tree_pinlocs.size()) {
+    return false;
+  }
+  sortPinLocs(pinlocs);
+  for (size_t i = 0; i < pinlocs.size(); i++) {
+    if (pinlocs[i].pin != tree_pinlocs[i].pin
+        || pinlocs[i].loc != tree_pinlocs[i].loc) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sort pins by location because connectedPins order is not deterministic.
+static void sortPinLocs(Vector<PinLoc>& pinlocs)
+{
+  sort(pinlocs, [=](const PinLoc& pin1, const PinLoc& pin2) {
+    return pin1.loc.getX() < pin2.loc.getX()
+           || (pin1.loc.getX() == pin2.loc.getX()
+               && pin1.loc.getY() < pin2.loc.getY());
+  });
+}
+
 static void connectedPins(const Net* net,
                           Network* network,
                           dbNetwork* db_network,
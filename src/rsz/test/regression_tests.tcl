@@ -69,6 +69,7 @@ record_tests {
   repair_setup5
   repair_setup6
   repair_setup7
+  repair_setup8
   repair_slew1
   repair_slew2
   repair_slew3
@@ -0,0 +1,73 @@
+# repair_timing -setup -batch_upsizes compared with plain upsizing
+# Both runs only resize so they start from and change the same netlist.
+source "helpers.tcl"
+define_corners fast slow
+read_liberty -corner slow Nangate45/Nangate45_slow.lib
+read_liberty -corner fast Nangate45/Nangate45_fast.lib
+read_lef Nangate45/Nangate45.lef
+read_def repair_setup1.def
+create_clock -period 0.3 clk
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+estimate_parasitics -placement
+
+report_worst_slack -max
+set slack_before [sta::worst_slack -max]
+
+set block [ord::get_db_block]
+set masters {}
+foreach inst [$block getInsts] {
+  dict set masters [$inst getName] [[$inst getMaster] getName]
+}
+
+# The resize counts depend on the sizing heuristics; the batch count is
+# checked below instead.
+suppress_message RSZ 41
+suppress_message RSZ 62
+suppress_message RSZ 144
+
+repair_timing -setup -skip_pin_swap -skip_gate_cloning -skip_buffering \
+  -skip_buffer_removal
+set slack_baseline [sta::worst_slack -max]
+set baseline_batched [rsz::repair_setup_batch_upsize_count]
+puts "baseline batch upsizes: $baseline_batched"
+
+# Put the original cells back for the batched run.
+set db [ord::get_db]
+foreach inst [$block getInsts] {
+  set master [$db findMaster [dict get $masters [$inst getName]]]
+  if { [$inst getMaster] != $master } {
+    $inst swapMaster $master
+  }
+}
+estimate_parasitics -placement
+report_worst_slack -max
+
+write_verilog_for_eqy repair_setup8 before "None"
+repair_timing -setup -skip_pin_swap -skip_gate_cloning -skip_buffering \
+  -skip_buffer_removal -batch_upsizes
+run_equivalence_test repair_setup8 ./Nangate45/work_around_yosys/ "None"
+set slack_batch [sta::worst_slack -max]
+set batched [rsz::repair_setup_batch_upsize_count]
+
+if { $batched > 0 } {
+  puts "batch upsizes applied"
+} else {
+  puts "no batch upsizes applied"
+}
+if { $slack_baseline > $slack_before } {
+  puts "plain upsizing improved worst slack"
+} else {
+  puts "plain upsizing did not improve worst slack"
+}
+if { $slack_batch > $slack_before } {
+  puts "batch upsizes improved worst slack"
+} else {
+  puts "batch upsizes did not improve worst slack"
+}
+if { $slack_batch >= $slack_baseline } {
+  puts "batch worst slack is no worse than plain upsizing"
+} else {
+  puts "batch worst slack is worse than plain upsizing"
+}
@@ -75,6 +75,16 @@ struct Tree
   int branchCount() const { return branch.size(); }
 };
 
+// Pin locations of one net for the batched Steiner tree API.
+// net is optional and only used to look up the net's alpha.
+struct SteinerNet
+{
+  odb::dbNet* net = nullptr;
+  std::vector<int> x;
+  std::vector<int> y;
+  int drvr_index = 0;
+};
+
 class SteinerTreeBuilder
 {
  public:
@@ -94,6 +104,10 @@ class SteinerTreeBuilder
                        const std::vector<int>& x,
                        const std::vector<int>& y,
                        int drvr_index);
+  // Build the trees for all nets using num_threads threads. The result is
+  // indexed like nets and matches calling makeSteinerTree on each net.
+  std::vector<Tree> makeSteinerTrees(const std::vector<SteinerNet>& nets,
+                                     int num_threads);
   // API only for FastRoute, that requires the use of flutes in its
   // internal flute implementation
   Tree makeSteinerTree(const std::vector<int>& x,
@@ -111,6 +125,7 @@ class SteinerTreeBuilder
 
  private:
   int computeHPWL(odb::dbNet* net);
+  float netAlpha(odb::dbNet* net);
 
   const int flute_accuracy = 3;
   float alpha_;
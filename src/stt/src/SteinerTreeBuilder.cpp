@@ -75,23 +75,7 @@ Tree SteinerTreeBuilder::makeSteinerTree(odb::dbNet* net,
                                          const std::vector<int>& y,
                                          const int drvr_index)
 {
-  float net_alpha = alpha_;
-  int min_fanout = min_fanout_alpha_.first;
-  int min_hpwl = min_hpwl_alpha_.first;
-
-  if (net_alpha_map_.find(net) != net_alpha_map_.end()) {
-    net_alpha = net_alpha_map_[net];
-  } else if (min_hpwl > 0) {
-    if (computeHPWL(net) >= min_hpwl) {
-      net_alpha = min_hpwl_alpha_.second;
-    }
-  } else if (min_fanout > 0) {
-    if (net->getTermCount() - 1 >= min_fanout) {
-      net_alpha = min_fanout_alpha_.second;
-    }
-  }
-
-  return makeSteinerTree(x, y, drvr_index, net_alpha);
+  return makeSteinerTree(x, y, drvr_index, netAlpha(net));
 }
 
 Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
@@ -109,6 +93,52 @@ Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
   return flt::flute(x, y, flute_accuracy);
 }
 
+std::vector<Tree> SteinerTreeBuilder::makeSteinerTrees(
+    const std::vector<SteinerNet>& nets,
+    const int num_threads)
+{
+  // Resolve the alphas up front so the parallel loop only reads the pin
+  // coordinates. PD keeps its scratch data on the stack and the flute
+  // lookup tables are built once under a lock, so the trees themselves
+  // can be computed independently.
+  std::vector<float> alphas;
+  alphas.reserve(nets.size());
+  for (const SteinerNet& net : nets) {
+    alphas.push_back(net.net != nullptr ? netAlpha(net.net) : alpha_);
+  }
+
+  std::vector<Tree> trees(nets.size());
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 64)
+  for (int i = 0; i < nets.size(); i++) {
+    const SteinerNet& net = nets[i];
+    trees[i] = makeSteinerTree(net.x, net.y, net.drvr_index, alphas[i]);
+  }
+
+  return trees;
+}
+
+float SteinerTreeBuilder::netAlpha(odb::dbNet* net)
+{
+  float net_alpha = alpha_;
+  int min_fanout = min_fanout_alpha_.first;
+  int min_hpwl = min_hpwl_alpha_.first;
+
+  const auto net_alpha_itr = net_alpha_map_.find(net);
+  if (net_alpha_itr != net_alpha_map_.end()) {
+    net_alpha = net_alpha_itr->second;
+  } else if (min_hpwl > 0) {
+    if (computeHPWL(net) >= min_hpwl) {
+      net_alpha = min_hpwl_alpha_.second;
+    }
+  } else if (min_fanout > 0) {
+    if (net->getTermCount() - 1 >= min_fanout) {
+      net_alpha = min_fanout_alpha_.second;
+    }
+  }
+
+  return net_alpha;
+}
+
 Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
                                          const std::vector<int>& y,
                                          const std::vector<int>& s,
@@ -33,12 +33,14 @@
 #include "stt/flute.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 
 // Use flute LUT file reader.
@@ -215,7 +217,10 @@ static void checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+static std::atomic<int> lut_valid_d = 0;
+// Serializes lazy LUT construction so flute can be called from several
+// threads at once.
+static std::mutex lut_mutex;
 
 extern std::string post9;
 extern std::string powv9;
@@ -300,8 +305,11 @@ inline const char* readDecimalInt(const char* s, int& value)
 }
 
 // Init LUTs from base64 encoded string variables.
+// Degrees that are already valid are parsed but left untouched so that
+// concurrent readers of those degrees are not disturbed.
 static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 {
+  const int from_d = lut_valid_d;
   std::string pwv_string = base64_decode(powv9);
   const char* pwv = pwv_string.c_str();
 
@@ -321,18 +329,24 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
     }
     ++prt;
 #endif
+    const bool keep = d > from_d;
     for (int k = 0; k < numgrp[d]; k++) {
       int ns = charNum(*pwv++);
       if (ns == 0) {  // same as some previous group
         int kk;
         pwv = readDecimalInt(pwv, kk) + 1;
-        numsoln[d][k] = numsoln[d][kk];
-        LUT[d][k] = LUT[d][kk];
+        if (keep) {
+          numsoln[d][k] = numsoln[d][kk];
+          LUT[d][k] = LUT[d][kk];
+        }
       } else {
         pwv++;  // '\n'
-        numsoln[d][k] = ns;
         struct csoln* p = new struct csoln[ns];
-        LUT[d][k] = p;
+        struct csoln* group = p;
+        if (keep) {
+          numsoln[d][k] = ns;
+          LUT[d][k] = p;
+        }
         for (int i = 1; i <= ns; i++) {
           p->parent = charNum(*pwv++);
 
@@ -370,6 +384,9 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 #endif
           p++;
         }
+        if (!keep) {
+          delete[] group;
+        }
       }
     }
   }
@@ -378,6 +395,11 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 
 static void ensureLUT(int d)
 {
+  const int valid_d = lut_valid_d;
+  if (valid_d > 0 && (d <= valid_d || d > FLUTE_D)) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex);
   if (LUT == nullptr) {
     readLUT();
   }